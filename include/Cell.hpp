@@ -0,0 +1,65 @@
+#ifndef CELL_HPP
+#define CELL_HPP
+
+#include <vector>
+
+/**
+ * @brief Descripteur des dimensions d'une grille, partagé par toutes ses cellules
+ *
+ * Contient les tailles et les pas (strides) row-major de chaque axe, avec la même
+ * convention que Environnement::coordinatesToIndex (le dernier axe varie le plus vite).
+ */
+class GridShape
+{
+private:
+    std::vector<int> dims;
+    std::vector<long long> strides;
+    long long total;
+
+public:
+    GridShape();
+    explicit GridShape(const std::vector<int>& dimensions);
+
+    int get_dim() const { return static_cast<int>(dims.size()); }
+    int size(int axis) const { return dims[axis]; }
+    long long stride(int axis) const { return strides[axis]; }
+    long long get_total() const { return total; }
+    const std::vector<int>& get_dims() const { return dims; }
+
+    /**
+     * @brief Coordonnée entière d'un index linéaire le long d'un axe, sans allocation
+     */
+    int coord(long long index, int axis) const { return static_cast<int>((index / strides[axis]) % dims[axis]); }
+};
+
+/**
+ * @brief Poignée légère vers une cellule : index linéaire + descripteur de grille
+ *
+ * Les coordonnées ne sont pas stockées, elles sont recalculées à la demande
+ * à partir de l'index (équivalent de Environnement::indexToCoordinates).
+ */
+class Cell
+{
+private:
+    long long index;
+    const GridShape* shape;
+
+public:
+    Cell(long long idx, const GridShape* grid_shape) : index(idx), shape(grid_shape) {}
+
+    long long get_index() const { return index; }
+    int get_dim() const { return shape->get_dim(); }
+    const GridShape& get_shape() const { return *shape; }
+
+    /**
+     * @brief Coordonnée de la cellule le long d'un axe
+     */
+    int coord(int axis) const { return shape->coord(index, axis); }
+
+    /**
+     * @brief Coordonnées sous forme de vecteur (alloue : réservé aux chemins non critiques)
+     */
+    std::vector<float> get_coords() const;
+};
+
+#endif // CELL_HPP
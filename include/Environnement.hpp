@@ -2,43 +2,211 @@
 #define ENVIRONNEMENT_HPP
 
 #include "Point.hpp"
+#include "Cell.hpp"
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <vector>
 #include <string>
 
 class Environnement
 {
+public:
+    /**
+     * @brief Mode de stockage des points de la grille
+     */
+    enum Backend {
+        MAP,   ///< std::map indexée par coordonnées (historique, accès O(log N))
+        DENSE  ///< Tableau contigu row-major indexé comme coordinatesToIndex (accès O(1))
+    };
+
+    static constexpr int MAX_DIMS = 16;                     ///< Nombre maximal de dimensions supporté
+    static constexpr int MAX_AXIS_NEIGHBORS = 2 * MAX_DIMS; ///< Taille de buffer suffisante pour get_neigh
+
 protected:  // Changé de private à protected pour l'héritage
-    std::map<std::vector<float>, Point> pointMap;
+    Backend backend;
+    std::map<std::vector<float>, Point> pointMap;   ///< Stockage MAP
+    std::vector<unsigned char> obstacleGrid;        ///< Stockage DENSE : un octet par cellule, toutes existent
+    std::shared_ptr<const GridShape> shape;         ///< Descripteur partagé par toutes les Cell de la grille
     std::vector<int> dims;
+    std::vector<float> costGrid;                    ///< Coût par unité de distance de chaque cellule (vide : uniforme, 1)
+    std::uint64_t costVersion;                      ///< Incrémenté à chaque modification du champ de coût
+    std::uint64_t costFieldVersion;                 ///< Incrémenté quand le champ entier est remplacé ou effacé
+    std::uint64_t obstacleVersion;                  ///< Change à chaque modification des obstacles (unique entre environnements)
 
 public:
-    Environnement();
+    explicit Environnement(Backend storage = MAP);
     Environnement(const Environnement& env);
     virtual ~Environnement() = default;  // Destructeur virtuel pour l'héritage
 
     // Setter pour les dimensions
     void set_dims(const std::vector<int>& dimensions);
 
-    // Gestion des points
+    // Gestion des points (vue de compatibilité : les Point sont construits à la demande)
     void addPoint(const Point& point);
-    Point& getPoint(const std::vector<float>& coords);
-    const Point& getPoint(const std::vector<float>& coords) const;
+    Point getPoint(const std::vector<float>& coords) const;
     bool hasPoint(const std::vector<float>& coords) const;
 
+    // Accès par index linéaire (même convention que coordinatesToIndex)
+
+    /**
+     * @brief Index linéaire d'un point existant
+     * @return -1 si aucun point n'existe à ces coordonnées
+     */
+    long long index_of(const std::vector<float>& coords) const;
+
+    /**
+     * @brief Indique si la cellule d'index donné existe (toujours vrai en DENSE)
+     */
+    bool has_index(long long index) const;
+
+    /**
+     * @brief Poignée vers une cellule, coordonnées calculées à la demande sans allocation
+     */
+    Cell cell(long long index) const { return Cell(index, shape.get()); }
+    const GridShape& get_shape() const { return *shape; }
+
+    /**
+     * @brief Vue Point (coordonnées + obstacle) d'une cellule
+     */
+    Point point_at(long long index) const;
+
+    bool is_obstacle(long long index) const;
+
+    /**
+     * @brief Définit l'état d'obstacle d'une cellule (en MAP, crée le point s'il n'existe pas)
+     */
+    void set_obs(long long index, bool obstacle);
+
     // Méthodes virtualisées pour permettre la périodicité
     virtual bool is_in_bounds(const std::vector<float>& coords) const;
-    virtual std::vector<Point*> get_neigh(const Point& pt);
-    virtual std::vector<std::pair<Point*, float>> get_hypercube_corners_with_weights(const std::vector<float>& coords) const;
+    virtual bool is_periodic(int dim_index) const { (void)dim_index; return false; }
+
+    /**
+     * @brief Voisins axiaux d'une cellule, écrits dans un buffer fourni par l'appelant (sans allocation)
+     *
+     * Écrit exactement deux index par axe (inférieur puis supérieur), calculés par décalage
+     * de l'index linéaire avec les strides précalculés du GridShape. Au bord d'un axe non
+     * périodique, le voisin manquant est remplacé par le voisin opposé.
+     * @param index Index linéaire de la cellule
+     * @param neighbors Buffer d'au moins MAX_AXIS_NEIGHBORS éléments
+     * @return Nombre d'index écrits (2 * nombre de dimensions)
+     */
+    virtual int get_neigh(long long index, long long* neighbors) const;
+
+    /**
+     * @brief Appelle func(index_voisin) pour chaque voisin axial, sans allocation
+     */
+    template <typename Func>
+    void for_each_neigh(long long index, Func&& func) const
+    {
+        long long neighbors[MAX_AXIS_NEIGHBORS];
+        int count = get_neigh(index, neighbors);
+        for (int k = 0; k < count; k++) func(neighbors[k]);
+    }
+
+    /**
+     * @brief Version vecteur de get_neigh (alloue : compatibilité)
+     */
+    std::vector<long long> get_neigh(const Cell& cell) const;
+    virtual std::vector<std::pair<long long, float>> get_hypercube_corners_with_weights(const std::vector<float>& coords) const;
     virtual float calculate_distance(const std::vector<float>& a, const std::vector<float>& b, int norm_type = 2) const;
+    virtual float calculate_distance(const Cell& a, const std::vector<float>& b, int norm_type = 2) const;
 
     // Accesseurs
+    Backend get_backend() const { return backend; }
+    size_t get_point_count() const { return backend == DENSE ? obstacleGrid.size() : pointMap.size(); }
     std::map<std::vector<float>, Point> get_map() const { return pointMap; }
-    std::map<std::vector<float>, Point>& get_map_ref() { return pointMap; }
+    /**
+     * @brief Accès modifiable au stockage MAP (change la version des obstacles)
+     */
+    std::map<std::vector<float>, Point>& get_map_ref();
     std::vector<int> get_dims() const { return dims; }
 
+    /**
+     * @brief Obstacles du backend DENSE, un octet par cellule (nullptr en MAP)
+     */
+    const unsigned char* get_obstacle_data() const { return backend == DENSE ? obstacleGrid.data() : nullptr; }
+
+    /**
+     * @brief Empreinte FNV-1a de l'existence et de l'état d'obstacle de chaque cellule
+     * Identifie la carte dans les précalculs sauvegardés (repères ALT, hiérarchie de contraction).
+     */
+    std::uint64_t get_obstacle_fingerprint() const;
+
+    /**
+     * @brief Version des obstacles, en O(1) : change à chaque set_obs, addPoint, set_dims ou
+     * get_map_ref. Les valeurs sont tirées d'un compteur global : deux environnements de même
+     * version (une copie et son original) ont les mêmes obstacles. Valable en mémoire
+     * uniquement, les précalculs sauvegardés utilisent get_obstacle_fingerprint.
+     */
+    std::uint64_t get_obstacle_version() const { return obstacleVersion; }
+
+    // Champ de coût (terrain) : multiplie le coût par unité de distance de FMM et de Dijkstra
+    // (et de leurs dérivés). La famille A*, A* bidirectionnel et D* Lite le refusent
+    // (std::logic_error) ; HPA* et la hiérarchie de contraction l'ignorent.
+
+    /**
+     * @brief Remplace le champ de coût, une valeur par cellule (même indexation que index_of)
+     * Stocké à plat pour les deux backends : les boucles de propagation le lisent sans recherche.
+     * @throws std::invalid_argument si la taille diffère du nombre de cellules ou si un coût n'est pas fini et > 0
+     */
+    void set_cost_field(const std::vector<float>& costs);
+
+    /**
+     * @brief Coût d'une cellule (crée un champ uniforme à 1 s'il n'existe pas)
+     * @throws std::invalid_argument si le coût n'est pas fini et > 0
+     */
+    void set_cost(long long index, float cost);
+
+    /**
+     * @brief Revient au coût uniforme (1 partout)
+     */
+    void clear_cost_field();
+
+    float get_cost(long long index) const { return costGrid.empty() ? 1.0f : costGrid[index]; }
+    bool has_cost_field() const { return !costGrid.empty(); }
+
+    /**
+     * @brief Champ de coût contigu (nullptr si uniforme)
+     */
+    const float* get_cost_data() const { return costGrid.empty() ? nullptr : costGrid.data(); }
+
+    /**
+     * @brief Plus petit coût de cellule (1 si uniforme) : largeur des seaux des frontières
+     */
+    float get_min_cost() const;
+
+    /**
+     * @brief Change à chaque modification du champ, set_cost compris : IncrementalFMM repart de zéro
+     */
+    std::uint64_t get_cost_version() const { return costVersion; }
+
+    /**
+     * @brief Ne change que si le champ entier est remplacé (set_cost_field, clear_cost_field,
+     * chargements) : set_cost le laisse inchangé, ses cellules se signalent aux calculs
+     * incrémentaux qui savent les réparer (IncrementalDijkstra::update_cells)
+     */
+    std::uint64_t get_cost_field_version() const { return costFieldVersion; }
+
+    /**
+     * @brief Champ de coût depuis une image en niveaux de gris de la taille de la grille 2D
+     * Convention de fromPNG : pixel clair = facile (min_cost), pixel noir = difficile (max_cost),
+     * interpolation linéaire entre les deux.
+     * @throws std::invalid_argument si la grille n'est pas 2D, si l'image n'a pas sa taille ou si 0 < min_cost <= max_cost n'est pas respecté
+     * @throws std::runtime_error si l'image ne peut pas être chargée
+     */
+    void load_costs_from_png(const std::string& filename, float min_cost, float max_cost);
+
+    /**
+     * @brief Champ de coût depuis un fichier brut de floats (un par cellule, ordre des index, sans en-tête)
+     * @throws std::runtime_error si le fichier est absent ou n'a pas exactement la taille attendue
+     * @throws std::invalid_argument si un coût n'est pas fini et > 0
+     */
+    void load_costs_from_raw(const std::string& filename);
+
     // Fonctions de chargement/sauvegarde d'images
-    static Environnement fromPNG(const std::string& filename, int obstacle_threshold = 128);
+    static Environnement fromPNG(const std::string& filename, int obstacle_threshold = 128, Backend storage = MAP);
     void toPNG(const std::string& filename) const;
 
     // Fonctions utilitaires statiques pour les coordonnées n-dimensionnelles
@@ -49,26 +217,20 @@ public:
     // Création d'environnements
     static Environnement createRandomEnvironment(const std::vector<int>& dimensions, 
                                                double obstacle_probability = 0.3, 
-                                               unsigned int seed = 0);
+                                               unsigned int seed = 0,
+                                               Backend storage = MAP);
     
     static Environnement createMazeEnvironment(const std::vector<int>& dimensions, 
-                                             unsigned int seed = 0);
+                                             unsigned int seed = 0,
+                                             Backend storage = MAP);
 
+protected:
     /**
-     * @brief Interpole une valeur au point flottant à partir des coins de l'hypercube
-     * @param coords Coordonnées du point flottant
-     * @return Valeur interpolée
-     */
-    float interpolate_from_corners(const std::vector<float>& coords) const;
-    
-    /**
-     * @brief Vérifie si tous les coins d'un hypercube ont été traités (état FROZEN)
-     * @param coords Coordonnées du point flottant
-     * @return true si tous les coins sont FROZEN
+     * @brief Index linéaire DENSE de coordonnées entières (même convention que coordinatesToIndex)
+     * @return -1 si les coordonnées sont hors grille ou non entières
      */
-    bool are_all_corners_frozen(const std::vector<float>& coords) const;
+    long long dense_index(const std::vector<float>& coords) const;
 
-protected:
     // Fonctions utilitaires protégées pour les classes dérivées
     static bool isAtBorder(const std::vector<int>& coords, const std::vector<int>& dimensions);
     static bool isValidCoordinate(const std::vector<int>& coords, const std::vector<int>& dimensions);
@@ -0,0 +1,159 @@
+#ifndef FIXEDGRID_HPP
+#define FIXEDGRID_HPP
+
+#include "Environnement.hpp"
+#include <array>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Vue d'une grille DENSE à nombre de dimensions fixé à la compilation
+ *
+ * Copie les tailles, strides, périodicités et le tableau d'obstacles d'un Environnement
+ * dans des std::array : les boucles sur les axes sont déroulées par le compilateur et
+ * les coordonnées ne sont jamais allouées. Même convention row-major que GridShape.
+ *
+ * Les voisins axiaux reproduisent Environnement::get_neigh et PeriodicEnvironnement::get_neigh,
+ * sans le remplacement du voisin manquant au bord (renvoie -1).
+ */
+template <int N>
+class FixedGrid
+{
+public:
+    static constexpr int DIM = N;
+    using Coords = std::array<int, N>;
+
+private:
+    std::array<int, N> dims;
+    std::array<long long, N> strides;
+    std::array<bool, N> periodic;
+    const unsigned char* obstacles;
+
+public:
+    explicit FixedGrid(const Environnement& env) : obstacles(env.get_obstacle_data())
+    {
+        const GridShape& shape = env.get_shape();
+        if (shape.get_dim() != N || obstacles == nullptr) {
+            throw std::invalid_argument("FixedGrid: environment must be DENSE with matching dimension count.");
+        }
+        for (int i = 0; i < N; i++) {
+            dims[i] = shape.size(i);
+            strides[i] = shape.stride(i);
+            periodic[i] = env.is_periodic(i);
+        }
+    }
+
+    static constexpr int dim() { return N; }
+    int size(int axis) const { return dims[axis]; }
+    bool is_obstacle(long long index) const { return obstacles[index] != 0; }
+
+    /**
+     * @brief Écart le long d'un axe entre une coordonnée entière et une coordonnée flottante
+     * (le plus court des deux sens sur un axe périodique)
+     */
+    float axis_distance(int axis, int a, float b) const
+    {
+        float diff = std::abs(static_cast<float>(a) - b);
+        return periodic[axis] ? std::min(diff, static_cast<float>(dims[axis]) - diff) : diff;
+    }
+
+    /**
+     * @brief Coordonnées entières d'un index linéaire
+     */
+    Coords coords(long long index) const
+    {
+        Coords c;
+        for (int i = N - 1; i >= 0; i--) {
+            c[i] = static_cast<int>(index % dims[i]);
+            index /= dims[i];
+        }
+        return c;
+    }
+
+    /**
+     * @brief Voisin axial d'une cellule (direction -1 ou +1 le long d'un axe)
+     * @param index Index linéaire de la cellule
+     * @param c Coordonnées de la cellule
+     * @return Index du voisin, -1 au bord d'un axe non périodique
+     */
+    long long neighbor(long long index, const Coords& c, int axis, int direction) const
+    {
+        if (direction < 0) {
+            if (c[axis] > 0) return index - strides[axis];
+            return periodic[axis] && dims[axis] > 1 ? index + strides[axis] * (dims[axis] - 1) : -1;
+        }
+        if (c[axis] < dims[axis] - 1) return index + strides[axis];
+        return periodic[axis] && dims[axis] > 1 ? index - strides[axis] * (dims[axis] - 1) : -1;
+    }
+
+    /**
+     * @brief Distance entre une cellule et un point flottant (norme 1, 2 ou infinie)
+     * Même sémantique que Environnement::calculate_distance ; chaque axe périodique
+     * prend le plus court des deux sens.
+     */
+    float distance(const Coords& a, const std::array<float, N>& b, int norm_type = 2) const
+    {
+        float result = 0.0f;
+        for (int i = 0; i < N; i++) {
+            float diff = axis_distance(i, a[i], b[i]);
+            if (norm_type == 1) result += diff;
+            else if (norm_type == 2) result += diff * diff;
+            else result = std::max(result, diff);
+        }
+        return norm_type == 2 ? std::sqrt(result) : result;
+    }
+};
+
+/**
+ * @brief Équivalent de FixedGrid pour un nombre de dimensions connu à l'exécution
+ *
+ * Même interface (dim, coords, axis_distance) pour que les heuristiques statiques
+ * s'écrivent une seule fois ; fonctionne avec les deux backends.
+ */
+class DynamicGrid
+{
+public:
+    using Coords = std::array<int, Environnement::MAX_DIMS>;
+
+private:
+    int dimension;
+    std::array<int, Environnement::MAX_DIMS> dims;
+    std::array<long long, Environnement::MAX_DIMS> strides;
+    std::array<bool, Environnement::MAX_DIMS> periodic;
+
+public:
+    DynamicGrid() : dimension(0), dims(), strides(), periodic() {}
+
+    explicit DynamicGrid(const Environnement& env) : DynamicGrid()
+    {
+        const GridShape& shape = env.get_shape();
+        dimension = shape.get_dim();
+        for (int i = 0; i < dimension; i++) {
+            dims[i] = shape.size(i);
+            strides[i] = shape.stride(i);
+            periodic[i] = env.is_periodic(i);
+        }
+    }
+
+    int dim() const { return dimension; }
+    int size(int axis) const { return dims[axis]; }
+
+    Coords coords(long long index) const
+    {
+        Coords c;
+        for (int i = dimension - 1; i >= 0; i--) {
+            c[i] = static_cast<int>(index % dims[i]);
+            index /= dims[i];
+        }
+        return c;
+    }
+
+    float axis_distance(int axis, int a, float b) const
+    {
+        float diff = std::abs(static_cast<float>(a) - b);
+        return periodic[axis] ? std::min(diff, static_cast<float>(dims[axis]) - diff) : diff;
+    }
+};
+
+#endif // FIXEDGRID_HPP
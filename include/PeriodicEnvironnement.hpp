@@ -29,8 +29,10 @@ public:
      * @brief Constructeur avec dimensions et périodicité
      * @param dimensions Tailles de chaque dimension
      * @param periodic Vecteur de booléens indiquant la périodicité de chaque dimension
+     * @param storage Backend de stockage des points (MAP ou DENSE)
      */
-    PeriodicEnvironnement(const std::vector<int>& dimensions, const std::vector<bool>& periodic);
+    PeriodicEnvironnement(const std::vector<int>& dimensions, const std::vector<bool>& periodic,
+                          Backend storage = MAP);
     
     /**
      * @brief Constructeur de copie depuis un Environnement classique
@@ -50,7 +52,7 @@ public:
      * @param dim_index Index de la dimension (0-indexé)
      * @return true si la dimension est périodique
      */
-    bool is_periodic(int dim_index) const;
+    bool is_periodic(int dim_index) const override;
     
     /**
      * @brief Obtient le vecteur de périodicité
@@ -70,13 +72,14 @@ public:
      * @brief Obtient les voisins d'un point en tenant compte de la périodicité
      * Les voisins peuvent "wraparound" aux bords dans les dimensions périodiques.
      */
-    std::vector<Point*> get_neigh(const Point& pt) override;
+    int get_neigh(long long index, long long* neighbors) const override;
+    using Environnement::get_neigh;
     
     /**
      * @brief Obtient les coins d'hypercube avec pondération pour interpolation périodique
      * Gère les hypercubes qui se chevauchent aux bords périodiques.
      */
-    std::vector<std::pair<Point*, float>> get_hypercube_corners_with_weights(const std::vector<float>& coords) const override;
+    std::vector<std::pair<long long, float>> get_hypercube_corners_with_weights(const std::vector<float>& coords) const override;
     
     /**
      * @brief Calcule la distance entre deux points en tenant compte de la périodicité
@@ -86,6 +89,7 @@ public:
      * @return Distance minimale (peut passer par les bords périodiques)
      */
     float calculate_distance(const std::vector<float>& a, const std::vector<float>& b, int norm_type = 2) const override;
+    float calculate_distance(const Cell& a, const std::vector<float>& b, int norm_type = 2) const override;
 
     // Factory methods statiques pour créer des environnements périodiques
     
@@ -96,7 +100,8 @@ public:
         const std::vector<int>& dimensions,
         const std::vector<bool>& periodic,
         double obstacle_probability = 0.3,
-        unsigned int seed = 0);
+        unsigned int seed = 0,
+        Backend storage = MAP);
     
     /**
      * @brief Crée un labyrinthe avec périodicité
@@ -104,7 +109,8 @@ public:
     static std::unique_ptr<PeriodicEnvironnement> createPeriodicMazeEnvironment(
         const std::vector<int>& dimensions,
         const std::vector<bool>& periodic,
-        unsigned int seed = 0);
+        unsigned int seed = 0,
+        Backend storage = MAP);
 
 private:
     /**
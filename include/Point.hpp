@@ -12,6 +12,13 @@ enum State
     FAR,
 };
 
+/**
+ * @brief Vue de compatibilité sur une cellule (coordonnées, obstacle)
+ *
+ * Les environnements ne stockent plus de Point par cellule en mode DENSE et les
+ * recherches utilisent Cell + SearchWorkspace ; Point reste disponible pour
+ * l'API historique (getPoint, addPoint, stockage MAP).
+ */
 class Point
 {
 private:
@@ -0,0 +1,334 @@
+#ifndef ARASTAR_HPP
+#define ARASTAR_HPP
+
+#include "StaticAStar.hpp"
+#include "../../utils/PathExtractor.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Anytime Repairing A* (ARA*) : solution pondérée rapide, améliorée tant que le temps le permet
+ *
+ * Chaque itération est un A* pondéré de clé g + epsilon * h (epsilon joue le rôle du
+ * weight_factor de EuclideanHeuristic) : la première, avec l'epsilon initial, trouve vite
+ * une solution de coût <= epsilon * optimal. Epsilon diminue ensuite d'un pas à chaque
+ * itération jusqu'à 1 (solution optimale si l'heuristique est cohérente).
+ *
+ * Les itérations réutilisent l'effort des précédentes : les valeurs g et les parents sont
+ * conservés, une cellule déjà développée dont g baisse n'est pas ré-ouverte dans l'itération
+ * courante mais mise de côté (liste INCONS) et réinsérée, avec la frontière, à l'itération
+ * suivante. Seules les cellules améliorées sont donc re-développées.
+ *
+ * plan(deadline) s'interrompt à l'échéance et renvoie le meilleur chemin trouvé ; un appel
+ * suivant reprend la recherche là où elle s'était arrêtée. La borne de sous-optimalité
+ * rapportée est min(epsilon, coût / min sur OPEN et INCONS de g + h).
+ * Après un changement de carte, de départ ou d'arrivée, appeler reset().
+ *
+ * Les arrivées doivent être des cellules (coordonnées entières). La frontière doit être
+ * le tas exact (DARY_HEAP) : les clés pondérées ne sont pas monotones.
+ *
+ * Exemple:
+ *     ARAStar<EuclideanDistance> planner(&env, 1.0f, EuclideanDistance(), 3.0f, 0.5f);
+ *     planner.add_start(start); planner.add_end(goal);
+ *     auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(5);
+ *     const std::vector<long long>& path = planner.plan(deadline);
+ *     float bound = planner.get_suboptimality_bound();
+ */
+template <typename Heuristic>
+class ARAStar : public StaticAStar<Heuristic>
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+protected:
+    using StaticAStar<Heuristic>::env;
+    using StaticAStar<Heuristic>::workspace;
+    using StaticAStar<Heuristic>::front;
+    using StaticAStar<Heuristic>::stats;
+    using StaticAStar<Heuristic>::verbose;
+    using StaticAStar<Heuristic>::starts;
+    using StaticAStar<Heuristic>::ends;
+    using StaticAStar<Heuristic>::queue_policy;
+    using StaticAStar<Heuristic>::edge_cost;
+    using StaticAStar<Heuristic>::goal_cells;
+    using StaticAStar<Heuristic>::dynamic_grid;
+
+    float initial_epsilon;            ///< Inflation de la première itération (>= 1)
+    float epsilon_step;               ///< Diminution d'epsilon entre deux itérations (> 0)
+    float epsilon;                    ///< Inflation de l'itération en cours
+    bool started;                     ///< Une recherche est en cours (état réutilisable)
+    bool finished;                    ///< Itération epsilon = 1 terminée, ou aucun chemin
+    int iterations;                   ///< Itérations terminées
+    std::vector<long long> open_cells;   ///< Cellules insérées dans la frontière pendant l'itération
+    std::vector<long long> closed_cells; ///< Cellules développées pendant l'itération
+    std::vector<long long> incons;       ///< Cellules développées dont g a baissé ensuite
+    std::vector<std::uint8_t> in_incons; ///< Appartenance à incons
+    std::vector<long long> best_path;    ///< Meilleur chemin trouvé (départ en tête)
+    float best_cost;                     ///< Coût de best_path
+    float bound;                         ///< Borne de sous-optimalité de best_path
+
+public:
+    /**
+     * @brief Constructeur
+     * @param environment Pointeur vers l'environnement
+     * @param cost Coût d'une arête (défaut: 1.0)
+     * @param h Heuristique cohérente (non pondérée)
+     * @param epsilon_start Inflation de la première itération (>= 1)
+     * @param step Diminution d'epsilon entre deux itérations (> 0)
+     * @throws std::invalid_argument si epsilon_start < 1 ou step <= 0
+     */
+    explicit ARAStar(Environnement* environment, float cost = 1.0f, Heuristic h = Heuristic(),
+                     float epsilon_start = 2.5f, float step = 0.5f)
+        : StaticAStar<Heuristic>(environment, cost, h), initial_epsilon(1.0f), epsilon_step(0.5f), epsilon(1.0f),
+          started(false), finished(false), iterations(0), best_cost(std::numeric_limits<float>::infinity()),
+          bound(std::numeric_limits<float>::infinity())
+    {
+        set_epsilon_schedule(epsilon_start, step);
+    }
+
+    virtual ~ARAStar() = default;
+
+    /**
+     * @brief Inflation initiale et pas de diminution (appliqués à la prochaine recherche)
+     * @throws std::invalid_argument si epsilon_start < 1 ou step <= 0
+     */
+    void set_epsilon_schedule(float epsilon_start, float step)
+    {
+        if (epsilon_start < 1.0f) {
+            throw std::invalid_argument("ARAStar: epsilon must be >= 1.0 to bound suboptimality.");
+        }
+        if (!(step > 0.0f)) {
+            throw std::invalid_argument("ARAStar: epsilon step must be > 0.");
+        }
+        initial_epsilon = epsilon_start;
+        epsilon_step = step;
+    }
+
+    float get_initial_epsilon() const { return initial_epsilon; }
+    float get_epsilon_step() const { return epsilon_step; }
+
+    /**
+     * @brief Abandonne la recherche en cours : le prochain plan() repart de zéro
+     */
+    void reset() { started = false; }
+
+    /**
+     * @brief Recherche jusqu'à la solution optimale, sans échéance
+     */
+    virtual void execute() override
+    {
+        reset();
+        plan(Clock::time_point::max());
+    }
+
+    /**
+     * @brief Démarre ou reprend la recherche jusqu'à l'échéance (ou jusqu'à epsilon = 1)
+     * Les compteurs cumulent toutes les itérations depuis le début de la recherche.
+     * @param deadline Instant au-delà duquel aucune cellule n'est plus développée
+     * @return Meilleur chemin trouvé (vide si aucun encore)
+     */
+    const std::vector<long long>& plan(Clock::time_point deadline)
+    {
+        if (!started) begin();
+        while (!finished && improve_path(deadline)) {
+            complete_iteration();
+        }
+        if (verbose) {
+            std::cout << "ARA* : epsilon " << epsilon << ", borne " << bound << ", "
+                      << iterations << " itérations, points traités: " << stats.expansions << std::endl;
+        }
+        return best_path;
+    }
+
+    /**
+     * @brief plan() avec une échéance relative à maintenant
+     */
+    template <typename Rep, typename Period>
+    const std::vector<long long>& plan_for(std::chrono::duration<Rep, Period> budget)
+    {
+        return plan(Clock::now() + std::chrono::duration_cast<Clock::duration>(budget));
+    }
+
+    const std::vector<long long>& get_path() const { return best_path; }
+
+    /**
+     * @brief Coût du meilleur chemin (INFINITY si aucun)
+     */
+    float get_path_cost() const { return best_cost; }
+
+    /**
+     * @brief Le coût du meilleur chemin est au plus borne × optimal (INFINITY sans chemin)
+     */
+    float get_suboptimality_bound() const { return bound; }
+
+    /**
+     * @brief Inflation de l'itération en cours (ou de la dernière si la recherche est terminée)
+     */
+    float get_epsilon() const { return epsilon; }
+
+    int get_iterations() const { return iterations; }
+
+    /**
+     * @brief Vrai quand plus aucune amélioration n'est possible (chemin optimal ou inexistant)
+     */
+    bool is_finished() const { return started && finished; }
+
+protected:
+    /**
+     * @brief Clé de la frontière : g + epsilon * h
+     */
+    virtual float get_priority(long long index, float value) const override
+    {
+        return value + epsilon * this->estimate(dynamic_grid, index, dynamic_grid.coords(index));
+    }
+
+private:
+    void begin()
+    {
+        if (starts.empty() || ends.empty()) {
+            throw std::invalid_argument("ARAStar: at least one start and one goal are required.");
+        }
+        for (const auto& end_coords : ends) {
+            if (env->index_of(end_coords) < 0) {
+                throw std::invalid_argument("ARAStar: goals must be grid cells.");
+            }
+        }
+
+        if (queue_policy != DARY_HEAP) {
+            throw std::logic_error("ARAStar: inflated keys require the DARY_HEAP queue policy.");
+        }
+
+        epsilon = initial_epsilon;
+        this->reset_environment();
+        this->initialize_starts();
+
+        open_cells.clear();
+        closed_cells.clear();
+        incons.clear();
+        in_incons.assign(workspace.size(), 0);
+        for (const auto& seed : this->seed_cells(starts)) {
+            if (workspace.get_state(seed.first) == FRONT) open_cells.push_back(seed.first);
+        }
+        best_path.clear();
+        best_cost = std::numeric_limits<float>::infinity();
+        bound = std::numeric_limits<float>::infinity();
+        iterations = 0;
+        started = true;
+        finished = false;
+    }
+
+    float goal_cost() const
+    {
+        float best = std::numeric_limits<float>::infinity();
+        for (long long goal : goal_cells) best = std::min(best, workspace.get_value(goal));
+        return best;
+    }
+
+    /**
+     * @brief Développe les cellules tant que la clé minimale est < g(arrivée)
+     * @return false si l'échéance a interrompu l'itération
+     */
+    bool improve_path(Clock::time_point deadline)
+    {
+        const bool timed = deadline != Clock::time_point::max();
+        while (!front->empty() && goal_cost() > front->top().value) {
+            // L'horloge n'est lue que toutes les 256 expansions
+            if (timed && (stats.expansions & 255) == 0 && Clock::now() >= deadline) return false;
+
+            long long current = front->pop().index;
+            stats.pops++;
+            workspace.set_state(current, FROZEN);
+            closed_cells.push_back(current);
+            stats.expansions++;
+
+            float g = workspace.get_value(current);
+            this->for_each_neighbor(current, [&](long long neighbor, float step_length) {
+                if (env->is_obstacle(neighbor)) return;
+                float new_value = g + edge_cost * step_length;
+                if (!(new_value < workspace.get_value(neighbor))) return;
+                workspace.set_value(neighbor, new_value);
+                workspace.set_parent(neighbor, current);
+                if (workspace.get_state(neighbor) == FROZEN) {
+                    // Déjà développée dans cette itération : réinsérée à la suivante
+                    if (!in_incons[neighbor]) {
+                        in_incons[neighbor] = 1;
+                        incons.push_back(neighbor);
+                    }
+                    return;
+                }
+                if (workspace.get_state(neighbor) != FRONT) open_cells.push_back(neighbor);
+                workspace.set_state(neighbor, FRONT);
+                this->push_front(neighbor, get_priority(neighbor, new_value));
+            });
+        }
+        return true;
+    }
+
+    /**
+     * @brief Enregistre la solution de l'itération, calcule la borne et prépare l'itération suivante
+     */
+    void complete_iteration()
+    {
+        iterations++;
+        float cost = goal_cost();
+        if (cost < best_cost) {
+            long long goal = goal_cells.front();
+            for (long long cell : goal_cells) {
+                if (workspace.get_value(cell) < workspace.get_value(goal)) goal = cell;
+            }
+            best_path = PathExtractor::extractPath(workspace, goal);
+            best_cost = cost;
+        }
+        if (std::isinf(best_cost)) {
+            // Frontière épuisée sans atteindre l'arrivée
+            finished = true;
+            return;
+        }
+
+        // Cellules encore incohérentes : frontière restante et INCONS
+        std::vector<long long> next_open;
+        next_open.reserve(open_cells.size() + incons.size());
+        for (long long cell : open_cells) {
+            if (workspace.get_state(cell) == FRONT) next_open.push_back(cell);
+        }
+        for (long long cell : incons) {
+            in_incons[cell] = 0;
+            next_open.push_back(cell);
+        }
+        incons.clear();
+
+        float min_f = std::numeric_limits<float>::infinity();
+        for (long long cell : next_open) {
+            float g = workspace.get_value(cell);
+            min_f = std::min(min_f, g + this->estimate(dynamic_grid, cell, dynamic_grid.coords(cell)));
+        }
+        bound = epsilon;
+        if (epsilon <= 1.0f || min_f >= best_cost) {
+            bound = 1.0f;
+        } else if (min_f > 0.0f) {
+            bound = std::min(epsilon, best_cost / min_f);
+        }
+        if (epsilon <= 1.0f || next_open.empty() || bound <= 1.0f) {
+            finished = true;
+            return;
+        }
+
+        // Itération suivante : epsilon réduit, CLOSED vidé, frontière reconstruite avec les nouvelles clés
+        epsilon = std::max(1.0f, std::min(epsilon - epsilon_step, bound));
+        for (long long cell : closed_cells) workspace.set_state(cell, FAR);
+        closed_cells.clear();
+        front->clear();
+        for (long long cell : next_open) {
+            workspace.set_state(cell, FRONT);
+            this->push_front(cell, get_priority(cell, workspace.get_value(cell)));
+        }
+        open_cells = std::move(next_open);
+    }
+};
+
+#endif // ARASTAR_HPP
@@ -1,7 +1,7 @@
 #ifndef ASTAR_HPP
 #define ASTAR_HPP
 
-#include "GraphSearchBase.hpp"
+#include "StaticAStar.hpp"
 #include "../strategies/HeuristicStrategy.hpp"
 #include "../strategies/CompositeHeuristic.hpp"
 #include "../strategies/DiagonalHeuristic.hpp"
@@ -23,13 +23,12 @@
  * et h(n) est le coût heuristique estimé du point n au point d'arrivée.
  * - Garantit le chemin optimal si l'heuristique est admissible (ne surestime jamais le coût réel).
  * - Plus efficace que Dijkstra pour des graphes de grande taille avec une bonne heuristique.
+ *
+ * L'heuristique est un HeuristicStrategy choisi à l'exécution (appel virtuel). Pour une
+ * heuristique connue à la compilation, utiliser directement StaticAStar<Heuristic>.
  */
-class AStar : public GraphSearchBase
+class AStar : public StaticAStar<StrategyHeuristic>
 {
-private:
-    float edge_cost; ///< Coût d'une arête (par défaut 1.0 pour grille uniforme)
-    HeuristicStrategy* heuristic_strategy; ///< Pointeur vers la stratégie d'heuristique actuelle
-
 public:
     /**
      * @brief Constructeur
@@ -46,18 +45,6 @@ public:
      */
     virtual ~AStar() = default;
 
-    /**
-     * @brief Modifie le coût d'une arête
-     * @param cost Nouveau coût d'arête
-     */
-    void set_edge_cost(float cost);
-
-    /**
-     * @brief Obtient le coût actuel d'une arête
-     * @return Coût d'arête
-     */
-    float get_edge_cost() const;
-
     /**
      * @brief Définit la stratégie d'heuristique à utiliser pour le calcul A*
      * @param heuristic_strat Pointeur vers la nouvelle stratégie d'heuristique
@@ -69,35 +56,6 @@ public:
      * @return Pointeur vers la stratégie d'heuristique. Peut être nullptr si aucune n'est définie.
      */
     const HeuristicStrategy* get_heuristic_strategy() const;
-
-protected:
-    /**
-     * @brief Calcule la nouvelle valeur U (f(n)) pour un voisin selon A*
-     * Pour A*: f(n) = g(n) + h(n)
-     * g(n) = valeur_actuelle (du parent) + coût_arête
-     * h(n) = heuristique(voisin, point_d_arrivee_le_plus_proche)
-     * @param current Point actuel (parent)
-     * @param neighbor Point voisin
-     * @return Nouvelle valeur U (f(n))
-     */
-    virtual float calculate_new_value(const Point* current, const Point* neighbor) override;
-
-    /**
-     * @brief Détermine si l'algorithme A* doit continuer
-     * S'arrête lorsque le point d'arrivée est atteint ou la frontière est vide.
-     * @return true si l'algorithme doit continuer
-     */
-    virtual bool should_continue() const override;
-
-private:
-    /**
-     * @brief Trouve le point d'arrivée le plus proche d'un point donné
-     * Utilisé pour les heuristiques. Retourne les coordonnées du goal, pas le Point*.
-     * @param p Le point à partir duquel chercher l'arrivée la plus proche
-     * @return Les coordonnées du point d'arrivée le plus proche sous forme de std::vector<float>.
-     * Retourne un vecteur vide si aucun point d'arrivée n'est défini.
-     */
-    std::vector<float> find_closest_end_coords(const Point* p) const;
 };
 
 #endif // ASTAR_HPP
\ No newline at end of file
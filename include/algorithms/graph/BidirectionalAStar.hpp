@@ -0,0 +1,234 @@
+#ifndef BIDIRECTIONALASTAR_HPP
+#define BIDIRECTIONALASTAR_HPP
+
+#include "GraphSearchBase.hpp"
+#include "../strategies/StaticHeuristics.hpp"
+#include "../../utils/PathExtractor.hpp"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief A* bidirectionnel point à point (Dijkstra bidirectionnel avec ZeroDistance)
+ *
+ * Deux frontières progressent simultanément : la frontière avant depuis les départs
+ * (workspace / front hérités) et la frontière arrière depuis les arrivées (backward).
+ * Les clés utilisent les potentiels moyens p(v) = (h_arrivée(v) - h_départ(v)) / 2 :
+ * clé avant = g_avant + p, clé arrière = g_arrière - p. Avec une heuristique cohérente,
+ * les coûts réduits sont positifs dans les deux sens et la recherche s'arrête dès que
+ * clé_min_avant + clé_min_arrière >= μ, μ étant le meilleur chemin complet rencontré :
+ * le coût renvoyé est alors optimal.
+ *
+ * Le côté développé à chaque itération est celui dont la frontière est la plus petite.
+ * La frontière doit être le tas exact (DARY_HEAP) : le critère d'arrêt lit les clés minimales.
+ * Les arêtes coûtent edge_cost × longueur : un environnement avec champ de coût est refusé.
+ *
+ * USAGE: requêtes point à point sur grandes cartes (couloirs, labyrinthes).
+ */
+template <typename Heuristic>
+class BidirectionalAStar : public GraphSearchBase
+{
+protected:
+    float edge_cost;                          ///< Coût d'une arête
+    Heuristic heuristic;                      ///< Heuristique (cohérente) vers les départs et les arrivées
+    DynamicGrid dynamic_grid;                 ///< Vue de la grille pour l'heuristique
+    SearchWorkspace backward;                 ///< État de la recherche arrière (depuis les arrivées)
+    std::unique_ptr<FrontQueue> backward_front; ///< Frontière arrière
+    float best_cost;                          ///< μ : coût du meilleur chemin complet trouvé
+    long long meeting;                        ///< Cellule de jonction du meilleur chemin (-1 si aucun)
+
+public:
+    /**
+     * @brief Constructeur
+     * @param environment Pointeur vers l'environnement
+     * @param cost Coût d'une arête (défaut: 1.0)
+     * @param h Heuristique (ZeroDistance : Dijkstra bidirectionnel)
+     */
+    explicit BidirectionalAStar(Environnement* environment, float cost = 1.0f, Heuristic h = Heuristic())
+        : GraphSearchBase(environment), edge_cost(cost), heuristic(h),
+          best_cost(std::numeric_limits<float>::infinity()), meeting(-1) {}
+
+    virtual ~BidirectionalAStar() = default;
+
+    void set_edge_cost(float cost) { edge_cost = cost; }
+    float get_edge_cost() const { return edge_cost; }
+
+    /**
+     * @brief Coût du plus court chemin entre départs et arrivées (INFINITY si aucun)
+     */
+    float get_path_cost() const { return best_cost; }
+
+    /**
+     * @brief Cellule où les deux recherches se rejoignent (-1 si aucun chemin)
+     */
+    long long get_meeting_index() const { return meeting; }
+
+    /**
+     * @brief Valeurs g de la recherche arrière (distance aux arrivées)
+     */
+    const SearchWorkspace& get_backward_workspace() const { return backward; }
+
+    /**
+     * @brief Chemin complet départ -> arrivée (index linéaires, vide si aucun chemin)
+     */
+    std::vector<long long> extract_path() const
+    {
+        if (meeting < 0) return {};
+        std::vector<long long> path = PathExtractor::extractPath(workspace, meeting);
+        for (long long current = meeting; backward.has_parent(current);) {
+            current = backward.get_parent(current);
+            path.push_back(current);
+        }
+        return path;
+    }
+
+protected:
+    virtual float calculate_new_value(long long current, long long neighbor, float step_length) override
+    {
+        (void)neighbor;
+        return workspace.get_value(current) + edge_cost * step_length;
+    }
+
+    /**
+     * @brief Clé avant : g + p(v)
+     */
+    virtual float get_priority(long long index, float value) const override
+    {
+        return value + potential(index);
+    }
+
+    /**
+     * @brief Initialise les deux recherches (départs en avant, arrivées en arrière)
+     */
+    virtual void initialize_starts() override
+    {
+        if (queue_policy != DARY_HEAP) {
+            throw std::logic_error("BidirectionalAStar: the stopping test requires the DARY_HEAP queue policy.");
+        }
+        if (env->has_cost_field()) {
+            throw std::logic_error("BidirectionalAStar: cost fields are not supported.");
+        }
+
+        dynamic_grid = DynamicGrid(*env);
+        best_cost = std::numeric_limits<float>::infinity();
+        meeting = -1;
+
+        long long total = env->get_shape().get_total();
+        if (backward.size() != total) backward.resize(total);
+        else backward.reset();
+        if (!backward_front || backward_front->capacity() != total) {
+            backward_front = FrontQueue::create(DARY_HEAP);
+            backward_front->resize(total);
+        } else {
+            backward_front->clear();
+        }
+
+        GraphSearchBase::initialize_starts();
+
+        for (const auto& end_coords : ends) {
+            long long end_index = env->index_of(end_coords);
+            if (end_index >= 0) {
+                seed_backward(end_index, 0.0f);
+            } else if (env->is_in_bounds(end_coords)) {
+                for (const auto& corner : env->get_hypercube_corners_with_weights(end_coords)) {
+                    seed_backward(corner.first, corner.second);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Boucle bidirectionnelle (remplace la boucle unidirectionnelle d'execute())
+     */
+    virtual bool run_fixed_dimension_loop() override
+    {
+        while (!front->empty() && !backward_front->empty()) {
+            if (front->top().value + backward_front->top().value >= best_cost) break;
+            expand(front->size() <= backward_front->size());
+        }
+        return true;
+    }
+
+private:
+    /**
+     * @brief Heuristique minimale d'une cellule vers un ensemble de points
+     */
+    float estimate_to(const std::vector<std::vector<float>>& targets, long long index) const
+    {
+        if (targets.empty()) return 0.0f;
+        auto coords = dynamic_grid.coords(index);
+        float best = std::numeric_limits<float>::infinity();
+        for (const auto& target : targets) {
+            best = std::min(best, heuristic(dynamic_grid, index, coords, target));
+        }
+        return best;
+    }
+
+    /**
+     * @brief Potentiel moyen p(v) = (h_arrivée(v) - h_départ(v)) / 2
+     */
+    float potential(long long index) const
+    {
+        return 0.5f * (estimate_to(ends, index) - estimate_to(starts, index));
+    }
+
+    void seed_backward(long long index, float value)
+    {
+        if (env->is_obstacle(index)) return;
+        if (backward.get_state(index) != FAR && backward.get_value(index) <= value) return;
+        backward.set_value(index, value);
+        backward.set_state(index, FRONT);
+        if (backward_front->push(index, value - potential(index))) stats.pushes++;
+        else stats.decrease_keys++;
+        record_meeting(index);
+    }
+
+    void record_meeting(long long index)
+    {
+        float total = workspace.get_value(index) + backward.get_value(index);
+        if (total < best_cost) {
+            best_cost = total;
+            meeting = index;
+        }
+    }
+
+    /**
+     * @brief Développe la meilleure cellule d'un des deux côtés
+     * @param forward true : côté départs, false : côté arrivées
+     */
+    void expand(bool forward)
+    {
+        SearchWorkspace& own = forward ? workspace : backward;
+        FrontQueue& queue = forward ? *front : *backward_front;
+
+        long long current = queue.pop().index;
+        stats.pops++;
+        own.set_state(current, FROZEN);
+        stats.expansions++;
+
+        auto relax = [&](long long neighbor, float step_length) {
+            if (env->is_obstacle(neighbor) || own.get_state(neighbor) == FROZEN) return;
+            float g = own.get_value(current) + edge_cost * step_length;
+            if (own.get_state(neighbor) == FAR || g < own.get_value(neighbor)) {
+                own.set_value(neighbor, g);
+                own.set_parent(neighbor, current);
+                own.set_state(neighbor, FRONT);
+                float p = potential(neighbor);
+                if (queue.push(neighbor, forward ? g + p : g - p)) stats.pushes++;
+                else stats.decrease_keys++;
+                record_meeting(neighbor);
+            }
+        };
+
+        for_each_neighbor(current, relax);
+    }
+};
+
+/**
+ * @brief Dijkstra bidirectionnel : heuristique nulle
+ */
+using BidirectionalDijkstra = BidirectionalAStar<ZeroDistance>;
+
+#endif // BIDIRECTIONALASTAR_HPP
@@ -0,0 +1,138 @@
+#ifndef CONTRACTIONHIERARCHY_HPP
+#define CONTRACTIONHIERARCHY_HPP
+
+#include "../../Environnement.hpp"
+#include "../../utils/IndexedHeap.hpp"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Hiérarchie de contraction (CH) du graphe de grille défini par get_neigh
+ *
+ * Prétraitement : les cellules libres sont contractées une à une (ordre par différence
+ * d'arêtes + voisins déjà contractés, mis à jour paresseusement). Contracter v ajoute un
+ * raccourci u - w entre deux voisins non contractés quand aucun chemin témoin évitant v
+ * n'est au plus aussi court que u - v - w (recherche témoin bornée). Seules les arêtes
+ * « montantes » (vers un rang supérieur) sont conservées, au format CSR.
+ *
+ * Les requêtes (CHQuery) sont des Dijkstra bidirectionnels sur le graphe montant, qui ne
+ * visitent que quelques centaines de nœuds : quelques microsecondes au lieu de
+ * millisecondes. La hiérarchie se sauvegarde et se recharge entre deux exécutions.
+ *
+ * Le graphe est non orienté : les arêtes montantes servent aux deux directions.
+ * Toutes les arêtes de la grille coûtent edge_cost : le champ de coût de l'environnement est ignoré.
+ */
+class ContractionHierarchy
+{
+public:
+    /**
+     * @brief Arête montante (ou raccourci) du graphe final
+     */
+    struct Arc {
+        int target;   ///< Nœud de rang supérieur
+        float cost;   ///< Longueur
+        int middle;   ///< Nœud contourné par le raccourci (-1 pour une arête de la grille)
+    };
+
+private:
+    const Environnement* env;
+    float edge_cost;
+    int witness_limit;                   ///< Nœuds établis au plus par recherche témoin
+    std::vector<int> node_of_cell;       ///< -1 pour obstacles et cellules inexistantes
+    std::vector<long long> cell_of_node;
+    std::vector<int> rank;               ///< Ordre de contraction
+    std::vector<int> first_arc;          ///< CSR : arcs montants de n dans [first_arc[n], first_arc[n + 1])
+    std::vector<Arc> arcs;
+    long long shortcut_count;
+
+public:
+    /**
+     * @brief Constructeur (n'effectue pas le prétraitement, voir build() ou load())
+     * @param environment Environnement (graphe des voisins axiaux de get_neigh)
+     * @param cost Coût d'une arête
+     * @param witness_settle_limit Borne des recherches témoins (plus petit : plus de raccourcis)
+     */
+    explicit ContractionHierarchy(const Environnement* environment, float cost = 1.0f, int witness_settle_limit = 500);
+
+    /**
+     * @brief Contracte tous les nœuds et construit le graphe montant
+     */
+    void build();
+
+    /**
+     * @brief Sauvegarde la hiérarchie (binaire)
+     */
+    void save(const std::string& filename) const;
+
+    /**
+     * @brief Recharge une hiérarchie calculée sur cet environnement
+     * @throws std::runtime_error si le fichier est illisible, corrompu (rangs, offsets ou arcs
+     * incohérents) ou correspond à une autre carte
+     */
+    void load(const std::string& filename);
+
+    bool is_built() const { return !first_arc.empty(); }
+    const Environnement& get_environment() const { return *env; }
+    int get_node_count() const { return static_cast<int>(cell_of_node.size()); }
+    long long get_arc_count() const { return static_cast<long long>(arcs.size()); }
+    long long get_shortcut_count() const { return shortcut_count; }
+
+    int node_of(long long cell) const { return (cell >= 0 && cell < static_cast<long long>(node_of_cell.size())) ? node_of_cell[cell] : -1; }
+    long long get_cell(int node) const { return cell_of_node[node]; }
+    int get_rank(int node) const { return rank[node]; }
+
+    int arcs_begin(int node) const { return first_arc[node]; }
+    int arcs_end(int node) const { return first_arc[node + 1]; }
+    const Arc& get_arc(int arc) const { return arcs[arc]; }
+
+    /**
+     * @brief Développe l'arête a - b (montante dans un sens ou l'autre) en nœuds de la grille
+     * Ajoute à path les nœuds après a, jusqu'à b inclus.
+     */
+    void unpack(int a, int b, std::vector<int>& path) const;
+
+private:
+    void build_nodes();
+};
+
+/**
+ * @brief Requête point à point sur une ContractionHierarchy
+ *
+ * Garde ses tampons entre deux requêtes (aucune allocation, réinitialisation limitée aux
+ * nœuds visités). Un objet par thread pour des requêtes concurrentes.
+ */
+class CHQuery
+{
+private:
+    const ContractionHierarchy* hierarchy;
+    std::vector<float> distances[2];   ///< Avant / arrière
+    std::vector<int> parents[2];
+    std::vector<int> touched;
+    IndexedHeap queues[2];
+    int meeting;
+    float best;
+    long long settled;
+
+public:
+    explicit CHQuery(const ContractionHierarchy* contraction_hierarchy);
+
+    /**
+     * @brief Distance entre deux cellules (index linéaires), INFINITY si non reliées
+     */
+    float distance(long long source_cell, long long target_cell);
+
+    /**
+     * @brief Chemin de la dernière requête (index de cellules, raccourcis développés)
+     */
+    std::vector<long long> get_path() const;
+
+    /**
+     * @brief Nœuds établis par la dernière requête (deux directions)
+     */
+    long long get_settled() const { return settled; }
+
+private:
+    void reset();
+};
+
+#endif // CONTRACTIONHIERARCHY_HPP
@@ -0,0 +1,289 @@
+#ifndef DSTARLITE_HPP
+#define DSTARLITE_HPP
+
+#include "GraphSearchBase.hpp"
+#include "../strategies/StaticHeuristics.hpp"
+#include "../../utils/PathExtractor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief D* Lite : replanification incrémentale d'un robot qui découvre les obstacles
+ *
+ * La recherche part des arrivées vers la position du robot (le départ) : la valeur U d'une
+ * cellule est g(s), sa distance aux arrivées, et son parent la cellule suivante vers
+ * l'arrivée. rhs(s) = min sur les voisins s' de c(s, s') + g(s') ; une cellule est dans la
+ * frontière tant que g(s) != rhs(s), avec la clé min(g, rhs) + h(robot, s) + km.
+ *
+ * Après un premier execute(), update_cells() signale les cellules dont l'état d'obstacle a
+ * changé (l'environnement a déjà été modifié par l'appelant) et replan() ne répare que les
+ * cellules devenues incohérentes. move_to() déplace le robot sans invalider la recherche
+ * (km accumule la variation de l'heuristique). extract_path() lit le chemin réparé via
+ * PathExtractor (parents = cellule suivante vers l'arrivée).
+ *
+ * La frontière doit être le tas exact (DARY_HEAP) : les clés remontent et sont retirées.
+ * Elle ne range que la première composante de la clé (le tas n'est pas lexicographique) :
+ * la boucle traite donc toutes les cellules de clé <= celle du robot, ce qui couvre l'ordre
+ * lexicographique sans le supposer. Les voisinages à cellules traversées (EuclideanNeighbors)
+ * ne sont pas acceptés : le changement d'une cellule y modifie des arêtes qui ne la touchent pas.
+ * Les arêtes coûtent edge_cost × longueur : un environnement avec champ de coût est refusé.
+ *
+ * Exemple:
+ *     DStarLite<ManhattanDistance> planner(&env);
+ *     planner.add_start(robot); planner.add_end(goal);
+ *     planner.execute();
+ *     env.set_obs(cell, true); planner.update_cells({cell}); planner.replan();
+ */
+template <typename Heuristic>
+class DStarLite : public GraphSearchBase
+{
+protected:
+    float edge_cost;                  ///< Coût d'une arête
+    Heuristic heuristic;              ///< Heuristique cohérente (distance au robot)
+    DynamicGrid dynamic_grid;         ///< Vue de la grille pour l'heuristique
+    std::vector<float> rhs;           ///< Valeur anticipée de chaque cellule
+    std::vector<std::pair<long long, float>> goal_seeds; ///< Cellules d'arrivée et leur valeur initiale
+    long long robot;                  ///< Cellule du robot (-1 avant execute)
+    std::vector<float> robot_coords;  ///< Coordonnées du robot pour l'heuristique
+    float km;                         ///< Décalage des clés dû aux déplacements du robot
+
+public:
+    /**
+     * @brief Constructeur
+     * @param environment Pointeur vers l'environnement
+     * @param cost Coût d'une arête (défaut: 1.0)
+     * @param h Heuristique cohérente (ZeroDistance : réparation de Dijkstra)
+     */
+    explicit DStarLite(Environnement* environment, float cost = 1.0f, Heuristic h = Heuristic())
+        : GraphSearchBase(environment), edge_cost(cost), heuristic(h), robot(-1), km(0.0f) {}
+
+    virtual ~DStarLite() = default;
+
+    float get_edge_cost() const { return edge_cost; }
+    float get_rhs(long long index) const { return rhs[index]; }
+
+    /**
+     * @brief Coût du chemin robot -> arrivée (INFINITY si aucun)
+     */
+    float get_path_cost() const { return robot >= 0 ? workspace.get_value(robot) : std::numeric_limits<float>::infinity(); }
+
+    /**
+     * @brief Chemin robot -> arrivée (index linéaires, vide si aucun chemin)
+     */
+    std::vector<long long> extract_path() const
+    {
+        if (std::isinf(get_path_cost())) return {};
+        std::vector<long long> path = PathExtractor::extractPath(workspace, robot);
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    /**
+     * @brief Déplace le robot (à appeler avant replan())
+     * @throws std::invalid_argument si les coordonnées ne désignent pas une cellule
+     */
+    void move_to(const std::vector<float>& coords)
+    {
+        require_search("move_to");
+        long long index = env->index_of(coords);
+        if (index < 0) throw std::invalid_argument("DStarLite::move_to: the robot must stand on a grid cell.");
+        km += estimate(index, robot_coords);
+        set_robot(index);
+    }
+
+    /**
+     * @brief Signale des cellules dont l'état d'obstacle a changé dans l'environnement
+     * Recalcule rhs de ces cellules et de leurs voisins ; la réparation est faite par replan().
+     */
+    void update_cells(const std::vector<long long>& cells)
+    {
+        require_search("update_cells");
+        for (long long cell : cells) {
+            if (!env->has_index(cell)) continue;
+            update_vertex(cell);
+            for_each_neighbor(cell, [&](long long neighbor, float) {
+                if (env->has_index(neighbor)) update_vertex(neighbor);
+            });
+        }
+    }
+
+    /**
+     * @brief Répare la solution après update_cells() / move_to() (compteurs remis à zéro)
+     */
+    void replan()
+    {
+        require_search("replan");
+        stats = SearchStatistics();
+        compute_shortest_path();
+    }
+
+protected:
+    virtual float calculate_new_value(long long current, long long neighbor, float step_length) override
+    {
+        (void)neighbor;
+        return workspace.get_value(current) + edge_cost * step_length;
+    }
+
+    /**
+     * @brief Initialise rhs, le robot (unique départ) et les arrivées
+     */
+    virtual void initialize_starts() override
+    {
+        if (queue_policy != DARY_HEAP) {
+            throw std::logic_error("DStarLite: key updates require the DARY_HEAP queue policy.");
+        }
+        if (neighborhood && neighborhood->has_swept_cells()) {
+            throw std::logic_error("DStarLite: neighborhoods with swept cells are not supported.");
+        }
+        if (env->has_cost_field()) {
+            throw std::logic_error("DStarLite: cost fields are not supported.");
+        }
+        if (starts.size() != 1 || env->index_of(starts.front()) < 0) {
+            throw std::invalid_argument("DStarLite: exactly one start on a grid cell (the robot) is required.");
+        }
+
+        dynamic_grid = DynamicGrid(*env);
+        rhs.assign(env->get_shape().get_total(), std::numeric_limits<float>::infinity());
+        km = 0.0f;
+        set_robot(env->index_of(starts.front()));
+
+        goal_seeds = seed_cells(ends);
+        for (const auto& seed : goal_seeds) update_vertex(seed.first);
+    }
+
+    /**
+     * @brief Boucle de D* Lite (remplace la boucle de Dijkstra d'execute())
+     */
+    virtual bool run_fixed_dimension_loop() override
+    {
+        compute_shortest_path();
+        return true;
+    }
+
+    /**
+     * @brief Première composante de la clé : min(g, rhs) + h(robot, s) + km
+     */
+    float calculate_key(long long index) const
+    {
+        return std::min(workspace.get_value(index), rhs[index]) + estimate(index, robot_coords) + km;
+    }
+
+private:
+    void require_search(const char* method) const
+    {
+        if (robot < 0 || static_cast<long long>(rhs.size()) != env->get_shape().get_total()) {
+            throw std::logic_error(std::string("DStarLite::") + method + ": execute() must be called first.");
+        }
+    }
+
+    void set_robot(long long index)
+    {
+        robot = index;
+        robot_coords = env->cell(index).get_coords();
+    }
+
+    /**
+     * @brief Heuristique entre une cellule et un point
+     */
+    float estimate(long long index, const std::vector<float>& target) const
+    {
+        return heuristic(dynamic_grid, index, dynamic_grid.coords(index), target);
+    }
+
+    bool is_free(long long index) const
+    {
+        return env->has_index(index) && !env->is_obstacle(index);
+    }
+
+    /**
+     * @brief (Re)place une cellule dans la frontière si elle est incohérente, l'en retire sinon
+     */
+    void refresh(long long index)
+    {
+        if (workspace.get_value(index) != rhs[index]) {
+            workspace.set_state(index, FRONT);
+            push_front(index, calculate_key(index));
+        } else if (front->contains(index)) {
+            front->erase(index);
+            workspace.set_state(index, FROZEN);
+        }
+    }
+
+    /**
+     * @brief Recalcule rhs (et le parent) d'une cellule à partir de tous ses voisins
+     */
+    void update_vertex(long long index)
+    {
+        float best = std::numeric_limits<float>::infinity();
+        long long parent = -1;
+        if (is_free(index)) {
+            for (const auto& seed : goal_seeds) {
+                if (seed.first == index) best = std::min(best, seed.second);
+            }
+            for_each_neighbor(index, [&](long long neighbor, float step_length) {
+                if (!is_free(neighbor)) return;
+                float candidate = workspace.get_value(neighbor) + edge_cost * step_length;
+                if (candidate < best) {
+                    best = candidate;
+                    parent = neighbor;
+                }
+            });
+        }
+        rhs[index] = best;
+        if (parent >= 0) workspace.set_parent(index, parent);
+        else workspace.clear_parent(index);
+        refresh(index);
+    }
+
+    void compute_shortest_path()
+    {
+        while (!front->empty()) {
+            FrontEntry top = front->top();
+            if (workspace.get_value(robot) == rhs[robot] && top.value > calculate_key(robot)) break;
+
+            long long current = top.index;
+            float key = calculate_key(current);
+            if (top.value < key) {
+                // Clé périmée (déplacement du robot) : réinsertion
+                push_front(current, key);
+                continue;
+            }
+            front->pop();
+            stats.pops++;
+            stats.expansions++;
+
+            float g = workspace.get_value(current);
+            if (g > rhs[current]) {
+                // Surcohérente : g devient définitif, les voisins peuvent passer par current
+                g = rhs[current];
+                workspace.set_value(current, g);
+                workspace.set_state(current, FROZEN);
+                for_each_neighbor(current, [&](long long neighbor, float step_length) {
+                    if (!is_free(neighbor)) return;
+                    float candidate = g + edge_cost * step_length;
+                    if (candidate < rhs[neighbor]) {
+                        rhs[neighbor] = candidate;
+                        workspace.set_parent(neighbor, current);
+                        refresh(neighbor);
+                    }
+                });
+            } else {
+                // Sous-cohérente : g remonte à l'infini, les voisins qui en dépendaient sont recalculés
+                workspace.set_value(current, std::numeric_limits<float>::infinity());
+                update_vertex(current);
+                for_each_neighbor(current, [&](long long neighbor, float) {
+                    if (is_free(neighbor) && workspace.has_parent(neighbor) &&
+                        static_cast<long long>(workspace.get_parent(neighbor)) == current) {
+                        update_vertex(neighbor);
+                    }
+                });
+            }
+        }
+    }
+};
+
+#endif // DSTARLITE_HPP
@@ -17,7 +17,7 @@
 class Dijkstra : public GraphSearchBase
 {
 private:
-    float edge_cost; ///< Coût d'une arête (par défaut 1.0 pour grille uniforme)
+    float edge_cost; ///< Coût d'une arête (par défaut 1.0 pour grille uniforme), multiplié par le champ de coût de l'environnement
 
 public:
     /**
@@ -47,12 +47,24 @@ public:
 protected:
     /**
      * @brief Calcule la nouvelle valeur U pour un voisin selon Dijkstra
-     * Pour Dijkstra: nouvelle_valeur = valeur_actuelle + coût_arête
-     * @param current Point actuel
-     * @param neighbor Point voisin (non utilisé dans Dijkstra basique)
+     * Pour Dijkstra: nouvelle_valeur = valeur_actuelle + coût_arête * longueur_arête,
+     * longueur multipliée par la moyenne des coûts des deux cellules si l'environnement a un champ de coût
+     * @param current Index de la cellule actuelle
+     * @param neighbor Index de la cellule voisine
+     * @param step_length Longueur de l'arête (1, √2, √3... selon le voisinage)
      * @return Nouvelle valeur U
      */
-    virtual float calculate_new_value(const Point* current, const Point* neighbor) override;
+    virtual float calculate_new_value(long long current, long long neighbor, float step_length) override;
+
+    /**
+     * @brief Plus petit coût d'arête (coût × plus petit coût de cellule × plus courte arête du voisinage) : seaux de Dial exacts
+     */
+    virtual float get_bucket_width() const override;
+
+    /**
+     * @brief Boucle spécialisée 2D / 3D (coût d'arête inliné)
+     */
+    virtual bool run_fixed_dimension_loop() override;
 };
 
 #endif // DIJKSTRA_HPP
\ No newline at end of file
@@ -5,6 +5,17 @@
 #include <limits>   // For std::numeric_limits
 #include <algorithm> // For std::sort
 #include <cmath>    // For std::sqrt
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Ordre du schéma upwind du FMM
+ */
+enum StencilOrder {
+    FIRST_ORDER,  ///< Un voisin par axe
+    SECOND_ORDER  ///< Deux cellules FROZEN par axe quand elles existent (ordre 1 sinon)
+};
 
 /**
  * @brief Implémentation de l'algorithme Fast Marching Method (FMM)
@@ -15,11 +26,17 @@
  *
  * Il partage des similarités avec Dijkstra mais utilise une mise à jour locale
  * basée sur l'équation Eikonal, ce qui le rend plus précis pour les fronts de propagation.
+ *
+ * En SECOND_ORDER, la dérivée le long d'un axe utilise les deux cellules amont FROZEN
+ * (3U - 4U1 + U2) / 2h quand U2 <= U1, et l'ordre 1 sinon (bord, obstacle, cellule non
+ * finalisée). Seule la marche du FMM (et ses seaux) l'utilise : FastSweeping et
+ * FastIterativeMethod le refusent (std::logic_error), IncrementalFMM relance un calcul complet.
  */
 class FMM : public GraphSearchBase
 {
 private:
-    float cost_per_unit_distance; ///< Coût par unité de distance (l'inverse de la vitesse locale, F^-1)
+    float cost_per_unit_distance; ///< Coût par unité de distance (l'inverse de la vitesse locale, F^-1), multiplié par le champ de coût de l'environnement
+    StencilOrder stencil_order;   ///< Ordre du schéma de la marche
 
 public:
     /**
@@ -46,6 +63,12 @@ public:
      */
     float get_cost_per_unit_distance() const;
 
+    /**
+     * @brief Ordre du schéma upwind (FIRST_ORDER par défaut)
+     */
+    void set_stencil_order(StencilOrder order) { stencil_order = order; }
+    StencilOrder get_stencil_order() const { return stencil_order; }
+
 protected:
     /**
      * @brief Calcule la nouvelle valeur U (temps/distance) pour un voisin selon FMM.
@@ -54,14 +77,124 @@ protected:
      * pour déterminer sa nouvelle valeur en résolvant une équation quadratique
      * ou en appliquant une mise à jour linéaire.
      *
-     * @param current Point actuel (le point dont la valeur U vient d'être finalisée)
-     * @param neighbor Point voisin dont la valeur U est à calculer/mettre à jour
+     * @param current Index de la cellule actuelle (dont la valeur U vient d'être finalisée)
+     * @param neighbor Index de la cellule voisine dont la valeur U est à calculer/mettre à jour
+     * @param step_length Non utilisé : le schéma Eikonal s'appuie toujours sur les voisins axiaux
      * @return Nouvelle valeur U calculée pour le voisin
      */
-    virtual float calculate_new_value(const Point* current, const Point* neighbor) override;
+    virtual float calculate_new_value(long long current, long long neighbor, float step_length) override;
+
+    /**
+     * @brief Largeur des seaux du FMM "untidy" : plus petit coût de cellule / sqrt(N)
+     * C'est le plus petit incrément d'une mise à jour symétrique (diagonale) ; l'erreur reste O(h).
+     */
+    virtual float get_bucket_width() const override;
+
+    /**
+     * @brief Boucle spécialisée 2D / 3D : voisins et équation Eikonal à N fixé
+     */
+    virtual bool run_fixed_dimension_loop() override;
+
+    /**
+     * @brief Résout l'équation Eikonal locale sur les axes amont
+     *
+     * Les valeurs sont triées en place ; les axes sont ajoutés un à un, par valeur croissante,
+     * tant que leur valeur reste inférieure à la solution courante (un axe aval ou FAR ne
+     * contribue pas). La quadratique est résolue sur les écarts à la plus petite valeur :
+     * le discriminant reste positif et garde sa précision quand les valeurs sont grandes.
+     * @param contributing_values Valeur U minimale des deux voisins de chaque axe (réordonnées)
+     * @param count Nombre d'axes
+     * @param cost Coût par unité de distance dans la cellule (cell_cost)
+     * @return INFINITY si aucun axe n'a de valeur finie
+     */
+    float solve_eikonal(float* contributing_values, int count, float cost) const;
+
+    /**
+     * @brief Même résolution que solve_eikonal(float*, int, float), boucles déroulées à N fixé
+     */
+    template <int N>
+    float solve_eikonal(std::array<float, N>& contributing_values, float cost) const;
+
+    /**
+     * @brief Résolution upwind d'ordre 2 : même sélection des axes que solve_eikonal
+     *
+     * Un axe dont second[i] est fini contribue avec le poids 9/4 et la valeur (4 first - second) / 3 ;
+     * les autres avec le poids 1 et la valeur first. Retour à l'ordre 1 si le discriminant est négatif.
+     * @param first Valeur U minimale des deux voisins de chaque axe (réordonnées avec second)
+     * @param second Cellule suivante du côté choisi, INFINITY si inutilisable
+     * @param count Nombre d'axes
+     * @param cost Coût par unité de distance dans la cellule
+     */
+    float solve_eikonal_second_order(float* first, float* second, int count, float cost) const;
+
+    /**
+     * @brief Valeur de la cellule à deux pas de cell sur l'axe, au-delà de upwind (voisin choisi)
+     * @return INFINITY sauf si upwind et cette cellule sont FROZEN avec une valeur <= celle de upwind
+     */
+    float second_upwind_value(long long cell, long long upwind, int axis) const;
+
+    /**
+     * @brief Coût par unité de distance d'une cellule : cost_per_unit_distance × champ de coût de l'environnement
+     */
+    float cell_cost(long long index) const
+    {
+        const float* costs = env->get_cost_data();
+        return costs ? cost_per_unit_distance * costs[index] : cost_per_unit_distance;
+    }
+
+    /**
+     * @brief Mise à jour locale (calculate_new_value) lue dans un tableau de valeurs plutôt que l'espace de travail
+     */
+    float local_update(const float* values, long long index);
 
+    /**
+     * @brief Champ initial des solveurs itératifs : départs à leur valeur, INFINITY ailleurs
+     * @param values Rempli avec une valeur par cellule de la grille
+     * @param fixed Rempli avec 1 pour les cellules jamais mises à jour (obstacles, absentes, départs)
+     */
+    void init_field(std::vector<float>& values, std::vector<std::uint8_t>& fixed) const;
 
-    float solve_eikonal(const std::vector<Point*>&);
+    /**
+     * @brief Recopie un champ calculé hors file dans l'espace de travail (cellules FROZEN),
+     * parent = voisin axial de plus petite valeur, pour PathExtractor
+     */
+    void store_field(const std::vector<float>& values);
 };
 
+inline float FMM::solve_eikonal(float* contributing_values, int count, float cost) const
+{
+    // Tri par insertion : au plus MAX_DIMS valeurs
+    for (int i = 1; i < count; i++) {
+        float value = contributing_values[i];
+        int j = i - 1;
+        for (; j >= 0 && contributing_values[j] > value; j--) contributing_values[j + 1] = contributing_values[j];
+        contributing_values[j + 1] = value;
+    }
+
+    if (count <= 0) return std::numeric_limits<float>::infinity();
+    const float base = contributing_values[0];
+    if (std::isinf(base)) return base;
+
+    // k axes d'écarts d_i = U_i - base : k t² - 2 S t + (Q - c²) = 0, S = somme des d_i, Q = somme des d_i²
+    float result = cost;
+    float sum = 0.0f;
+    float sum_of_squares = 0.0f;
+    for (int k = 1; k < count && base + result > contributing_values[k]; k++) {
+        float offset = contributing_values[k] - base;
+        sum += offset;
+        sum_of_squares += offset * offset;
+        float a = static_cast<float>(k + 1);
+        float delta = sum * sum - a * (sum_of_squares - cost * cost);
+        // delta >= 0 tant que l'axe ajouté est sous la solution précédente ; garde contre l'arrondi
+        result = (sum + std::sqrt(std::max(delta, 0.0f))) / a;
+    }
+    return base + result;
+}
+
+template <int N>
+float FMM::solve_eikonal(std::array<float, N>& contributing_values, float cost) const
+{
+    return solve_eikonal(contributing_values.data(), N, cost);
+}
+
 #endif // FMM_HPP
\ No newline at end of file
@@ -0,0 +1,96 @@
+#ifndef FASTITERATIVEMETHOD_HPP
+#define FASTITERATIVEMETHOD_HPP
+
+#include "FMM.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Fast Iterative Method (FIM) : résolution Eikonal par liste active, sans tas global
+ *
+ * Même équation et même mise à jour locale que le FMM (local_update). Une liste active
+ * contient les cellules dont la valeur peut encore baisser ; à chaque itération, toutes
+ * ses cellules sont mises à jour à partir du champ de l'itération précédente (schéma de
+ * Jacobi), par lots répartis sur les threads. Une cellule dont la valeur ne baisse plus
+ * (baisse relative <= tolérance) quitte la liste et propose ses voisins : ceux que sa
+ * valeur fait baisser y entrent. Le calcul s'arrête quand la liste est vide.
+ *
+ * Chaque lot ne lit que le champ de l'itération précédente et les ajouts sont fusionnés
+ * dans l'ordre de la liste : le résultat ne dépend pas du nombre de threads.
+ * Les parents sont fixés à la fin (voisin axial de plus petite valeur) pour PathExtractor.
+ */
+class FastIterativeMethod : public FMM
+{
+private:
+    int thread_count;       ///< Threads (0 = matériel disponible)
+    float tolerance;        ///< Baisse relative maximale d'une cellule considérée convergée
+    int iterations;         ///< Itérations (passes sur la liste active) de la dernière exécution
+    long long peak_active;  ///< Taille maximale de la liste active lors de la dernière exécution
+
+    /**
+     * @brief Cellules par thread en dessous desquelles un lot n'est pas découpé
+     */
+    static constexpr long long MIN_CELLS_PER_THREAD = 1024;
+
+public:
+    /**
+     * @brief Constructeur
+     * @param environment Pointeur vers l'environnement
+     * @param cost Coût par unité de distance (défaut: 1.0)
+     */
+    explicit FastIterativeMethod(Environnement* environment, float cost = 1.0f);
+
+    virtual ~FastIterativeMethod() = default;
+
+    /**
+     * @brief Calcule le champ par liste active (remplace la boucle du FMM)
+     * @throws std::logic_error si le schéma SECOND_ORDER est demandé
+     */
+    virtual void execute() override;
+
+    /**
+     * @brief Nombre de threads
+     * @param threads Nombre de threads (0 = std::thread::hardware_concurrency)
+     * @throws std::invalid_argument si threads < 0
+     */
+    void set_thread_count(int threads);
+    int get_thread_count() const { return thread_count; }
+
+    /**
+     * @brief Critère de convergence d'une cellule
+     * @param min_decrease Baisse relative minimale comptée comme un changement (>= 0)
+     * @throws std::invalid_argument si min_decrease < 0
+     */
+    void set_tolerance(float min_decrease);
+
+    /**
+     * @brief Itérations (passes sur la liste active) effectuées par la dernière exécution
+     */
+    int get_iterations() const { return iterations; }
+
+    /**
+     * @brief Taille maximale atteinte par la liste active
+     */
+    long long get_peak_active() const { return peak_active; }
+
+private:
+    /**
+     * @brief Une passe sur active[begin, end) : nouvelles valeurs et voisins proposés
+     * @param blocked 1 pour les cellules fixes ou déjà actives (jamais proposées)
+     * @param updated Nouvelle valeur de chaque cellule active
+     * @param converged 1 si la cellule active quitte la liste
+     * @param candidates Voisins que la valeur d'une cellule convergée fait baisser (index, valeur)
+     * @param updates Incrémenté du nombre de mises à jour locales calculées
+     */
+    void process_batch(const std::vector<float>& values, const std::vector<std::uint8_t>& blocked,
+                       const std::vector<long long>& active, long long begin, long long end,
+                       std::vector<float>& updated, std::vector<std::uint8_t>& converged,
+                       std::vector<std::pair<long long, float>>& candidates, long long& updates);
+
+    /**
+     * @brief Vrai si new_value baisse significativement old_value
+     */
+    bool decreases(float old_value, float new_value) const;
+};
+
+#endif // FASTITERATIVEMETHOD_HPP
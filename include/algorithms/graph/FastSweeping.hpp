@@ -0,0 +1,95 @@
+#ifndef FASTSWEEPING_HPP
+#define FASTSWEEPING_HPP
+
+#include "FMM.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Fast Sweeping Method : résolution Eikonal par balayages de Gauss-Seidel
+ *
+ * Même équation et même mise à jour locale que le FMM (minimum de chaque axe puis
+ * solve_eikonal), mais sans file de priorité : la grille est parcourue dans les 2^N
+ * ordres alternés (chaque axe croissant ou décroissant) et chaque cellule reçoit
+ * min(U, mise à jour). Un tour = les 2^N balayages ; le calcul s'arrête après un tour
+ * sans baisse relative supérieure à la tolérance (1e-5 par défaut : les arrondis de la
+ * racine carrée font sinon baisser le champ d'un ulp à chaque tour). Les départs gardent
+ * leur valeur initiale. solve_eikonal n'utilise que les axes amont : le champ convergé
+ * est celui du FMM.
+ *
+ * Variante parallèle (set_parallel) : à chaque tour, chaque ordre balaie sa propre copie
+ * du champ dans un thread, puis le champ reçoit le minimum des copies. Elle demande plus
+ * de tours que la version séquentielle mais les 2^N balayages s'exécutent simultanément.
+ *
+ * Le nombre de tours croît avec le nombre de changements de direction des
+ * caractéristiques : intéressant sur cartes ouvertes, coûteux dans un labyrinthe.
+ * Les parents sont fixés à la fin (voisin axial de plus petite valeur) pour PathExtractor.
+ */
+class FastSweeping : public FMM
+{
+private:
+    bool parallel;          ///< Ordres balayés simultanément
+    int thread_count;       ///< Threads de la variante parallèle (0 = matériel disponible)
+    float tolerance;        ///< Baisse relative minimale comptée comme un changement
+    int max_iterations;     ///< Nombre maximal de tours
+    int iterations;         ///< Tours effectués par la dernière exécution
+    bool converged;         ///< La dernière exécution s'est arrêtée sur un tour sans changement
+
+public:
+    /**
+     * @brief Constructeur
+     * @param environment Pointeur vers l'environnement
+     * @param cost Coût par unité de distance (défaut: 1.0)
+     */
+    explicit FastSweeping(Environnement* environment, float cost = 1.0f);
+
+    virtual ~FastSweeping() = default;
+
+    /**
+     * @brief Calcule le champ par balayages (remplace la boucle du FMM)
+     * @throws std::logic_error si le schéma SECOND_ORDER est demandé
+     */
+    virtual void execute() override;
+
+    /**
+     * @brief Active la variante parallèle
+     * @param enabled Ordres balayés simultanément
+     * @param threads Nombre de threads (0 = std::thread::hardware_concurrency, au plus 2^N utiles)
+     */
+    void set_parallel(bool enabled, int threads = 0);
+    bool is_parallel() const { return parallel; }
+
+    /**
+     * @brief Critère d'arrêt
+     * @param min_decrease Baisse relative minimale comptée comme un changement (>= 0)
+     * @param rounds Nombre maximal de tours (> 0)
+     * @throws std::invalid_argument si un paramètre est hors domaine
+     */
+    void set_convergence(float min_decrease, int rounds);
+
+    /**
+     * @brief Tours (2^N balayages chacun) effectués par la dernière exécution
+     */
+    int get_iterations() const { return iterations; }
+    bool has_converged() const { return converged; }
+
+private:
+    /**
+     * @brief Un balayage dans l'ordre donné (bit i : axe i décroissant)
+     * @param updates Incrémenté du nombre de mises à jour locales calculées
+     * @return Plus grande baisse observée
+     */
+    float sweep(float* values, const std::vector<std::uint8_t>& fixed, int ordering, long long& updates);
+
+    /**
+     * @brief Balayage à N fixé (2D / 3D, backend DENSE) : voisins calculés sans appel virtuel
+     */
+    template <int N>
+    float sweep_fixed(const FixedGrid<N>& grid, float* values, const std::vector<std::uint8_t>& fixed,
+                      int ordering, long long& updates);
+
+    void run_sequential(std::vector<float>& values, const std::vector<std::uint8_t>& fixed);
+    void run_parallel(std::vector<float>& values, const std::vector<std::uint8_t>& fixed);
+};
+
+#endif // FASTSWEEPING_HPP
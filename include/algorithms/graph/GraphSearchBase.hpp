@@ -3,22 +3,51 @@
 
 #include "../../Point.hpp"
 #include "../../Environnement.hpp"
+#include "../../FixedGrid.hpp"
 #include "../../utils/Comparison.hpp"
-#include <queue>
+#include "../../utils/FrontQueue.hpp"
+#include "SearchWorkspace.hpp"
+#include "neighbors/NeighborhoodStrategy.hpp"
+#include <utility>
 #include <vector>
 #include <string>
 
+/**
+ * @brief Compteurs d'une exécution (remis à zéro par reset_environment)
+ */
+struct SearchStatistics
+{
+    long long expansions = 0;    ///< Cellules passées à FROZEN et développées
+    long long pushes = 0;        ///< Insertions dans la frontière
+    long long pops = 0;          ///< Extractions de la frontière
+    long long decrease_keys = 0; ///< Mises à jour de la clé d'une cellule déjà dans la frontière
+};
+
 /**
  * @brief Classe de base abstraite pour tous les algorithmes de recherche de graphes
  * 
  * Cette classe fournit l'infrastructure commune pour les algorithmes comme Dijkstra, A*, FMM, etc.
  * Elle gère la priority queue, les points de départ/arrivée, et les fonctions de visualisation.
+ *
+ * L'état de la recherche (valeurs U, états, parents) est stocké dans un SearchWorkspace
+ * propre à l'instance : l'environnement n'est jamais modifié par une requête.
+ *
+ * La frontière est une file indexée (FrontQueue) : une cellule y figure au plus une
+ * fois et une amélioration de sa valeur est un decrease-key, sans doublon ni
+ * ré-expansion. Sa structure est choisie par set_queue_policy (tas 4-aire par défaut).
  */
 class GraphSearchBase
 {
 protected:
-    Environnement* env; 
-    std::priority_queue<Point*, std::vector<Point*>, Compare> front;
+    const Environnement* env; ///< Carte partagée, jamais modifiée par la recherche
+    SearchWorkspace workspace; ///< État de la requête, indexé par index linéaire de cellule
+    NeighborhoodStrategy* neighborhood; ///< Voisinage utilisé (nullptr = voisins axiaux de l'environnement)
+    std::unique_ptr<FrontQueue> front; ///< Frontière (une entrée par cellule au plus)
+    QueuePolicy queue_policy; ///< Structure de la frontière
+    float front_bucket_width; ///< Largeur de seau avec laquelle front a été créée
+    bool fixed_dimension_kernels; ///< Autorise les boucles spécialisées 2D / 3D
+    bool verbose; ///< Affiche le bilan de chaque exécution
+    SearchStatistics stats; ///< Compteurs de la dernière exécution
     std::vector<std::vector<float>> starts;
     std::vector<std::vector<float>> ends;
 
@@ -39,6 +68,36 @@ public:
     void add_end(const std::vector<float>& coords);
     void clear_starts();
     void clear_ends();
+
+    /**
+     * @brief Définit le voisinage utilisé pour l'expansion des points
+     * Le voisinage n'est pas possédé par la recherche et peut être partagé entre requêtes.
+     * @param neighbors Voisinage (nullptr = 2N voisins axiaux de l'environnement)
+     */
+    void set_neighborhood(NeighborhoodStrategy* neighbors);
+    const NeighborhoodStrategy* get_neighborhood() const { return neighborhood; }
+
+    /**
+     * @brief Choisit la structure de la frontière (appliqué à la prochaine exécution)
+     * DIAL_BUCKETS et RADIX_HEAP sont exacts pour Dijkstra ; UNTIDY_BUCKETS est destiné au FMM.
+     * La famille A* n'accepte que DARY_HEAP et RADIX_HEAP (clés f monotones).
+     * @param policy Structure de données de la frontière
+     */
+    void set_queue_policy(QueuePolicy policy);
+    QueuePolicy get_queue_policy() const { return queue_policy; }
+
+    /**
+     * @brief Active ou non les boucles spécialisées à dimension fixe (2D / 3D, backend DENSE)
+     * Activées par défaut ; les résultats sont identiques à la boucle générique.
+     */
+    void set_fixed_dimension_kernels(bool enabled) { fixed_dimension_kernels = enabled; }
+    bool get_fixed_dimension_kernels() const { return fixed_dimension_kernels; }
+
+    /**
+     * @brief Active ou non le message de fin d'exécution (désactivé pour les recherches
+     * internes répétées : prétraitements, sous-recherches par cluster)
+     */
+    void set_verbose(bool enabled) { verbose = enabled; }
     
     // Réinitialisation
     void reset_environment();
@@ -46,8 +105,25 @@ public:
     /**
      * @brief Méthode principale d'exécution de l'algorithme
      * Template method pattern - appelle les méthodes virtuelles spécialisées
+     * (virtuelle pour les variantes incrémentales qui conservent leur état entre deux appels)
      */
-    void execute();
+    virtual void execute();
+
+    /**
+     * @brief Valeur U calculée pour une cellule (INFINITY si inexistante ou non atteinte)
+     * @param coords Coordonnées entières de la cellule
+     */
+    float get_value(const std::vector<float>& coords) const;
+
+    /**
+     * @brief Accès en lecture à l'état de la dernière exécution
+     */
+    const SearchWorkspace& get_workspace() const { return workspace; }
+
+    /**
+     * @brief Compteurs (expansions, insertions, extractions) de la dernière exécution
+     */
+    const SearchStatistics& get_statistics() const { return stats; }
     
     // Affichage et sauvegarde des résultats (communs à tous les algorithmes)
     void display_U_values_grid() const;
@@ -63,12 +139,56 @@ protected:
     /**
      * @brief Calcule la nouvelle valeur U pour un voisin
      * Méthode virtuelle pure - doit être implémentée par chaque algorithme
-     * @param current Point actuel
-     * @param neighbor Point voisin
+     * @param current Index de la cellule actuelle
+     * @param neighbor Index de la cellule voisine
+     * @param step_length Longueur de l'arête current -> neighbor (1 pour un voisin axial)
      * @return Nouvelle valeur U pour le voisin
      */
-    virtual float calculate_new_value(const Point* current, const Point* neighbor) = 0;
+    virtual float calculate_new_value(long long current, long long neighbor, float step_length) = 0;
     
+    /**
+     * @brief Boucle principale spécialisée, appelée par execute() à la place de la boucle générique
+     * Par défaut aucune spécialisation ; les algorithmes l'implémentent via run_fixed_dimension().
+     * @return true si la recherche a été exécutée
+     */
+    virtual bool run_fixed_dimension_loop();
+
+    /**
+     * @brief Lance run_axial_kernel<N> si la grille s'y prête (2D / 3D, DENSE, voisins axiaux)
+     * @param update Foncteur update(grid, current, neighbor, neighbor_coords) -> nouvelle valeur
+     * @param priority Foncteur priority(grid, neighbor, neighbor_coords, value) -> clé dans la frontière
+     * @return false si la boucle générique doit être utilisée
+     */
+    template <typename Update, typename Priority>
+    bool run_fixed_dimension(Update&& update, Priority&& priority);
+
+    /**
+     * @brief Idem, la clé de la frontière étant la valeur elle-même
+     */
+    template <typename Update>
+    bool run_fixed_dimension(Update&& update);
+
+    /**
+     * @brief Boucle principale à N fixé : voisins axiaux et test d'obstacle déroulés, mise à jour inlinée
+     * Mêmes règles que la boucle générique (obstacles et cellules FROZEN ignorés, ordre des voisins).
+     */
+    template <int N, typename Update, typename Priority>
+    void run_axial_kernel(Update& update, Priority& priority);
+
+    /**
+     * @brief Clé d'une cellule dans la frontière (par défaut sa valeur ; A* : g + h)
+     * @param index Index de la cellule
+     * @param value Valeur U de la cellule
+     */
+    virtual float get_priority(long long index, float value) const;
+
+    /**
+     * @brief Largeur des seaux pour DIAL_BUCKETS / UNTIDY_BUCKETS
+     * Doit être <= au plus petit écart entre la valeur d'une cellule et celle de son parent
+     * pour que les seaux de Dial soient exacts. Par défaut 1.
+     */
+    virtual float get_bucket_width() const;
+
     /**
      * @brief Détermine si l'algorithme doit continuer
      * Par défaut continue tant que la front n'est pas vide
@@ -81,25 +201,48 @@ protected:
      * @brief Traite un point de la frontière
      * Par défaut traite tous les voisins
      * Peut être overridée pour des comportements spécifiques
-     * @param current Point à traiter
+     * @param current Index de la cellule à traiter
+     */
+    virtual void process_point(long long current);
+
+    /**
+     * @brief Appelle func(index_voisin, longueur_arête) pour chaque voisin (stencil ou get_neigh)
+     * Les obstacles ne sont pas filtrés.
      */
-    virtual void process_point(Point* current);
+    template <typename Func>
+    void for_each_neighbor(long long index, Func&& func) const;
+
+    /**
+     * @brief Relâche l'arête current -> neighbor (test, calcul de la valeur, mise à jour)
+     */
+    void relax_neighbor(long long current, long long neighbor, float step_length);
     
     /**
      * @brief Détermine si un voisin doit être mis à jour
      * Par défaut: ignore obstacles et points FROZEN
-     * @param neighbor Point voisin à tester
+     * @param neighbor Index de la cellule voisine à tester
      * @return true si le voisin peut être mis à jour
      */
-    virtual bool should_update_neighbor(const Point* neighbor) const;
+    virtual bool should_update_neighbor(long long neighbor) const;
     
     /**
      * @brief Met à jour un voisin avec une nouvelle valeur
-     * @param neighbor Point voisin à mettre à jour
+     * @param neighbor Index de la cellule voisine à mettre à jour
      * @param new_value Nouvelle valeur U
-     * @param parent Nouveau parent
+     * @param parent Index du nouveau parent
+     */
+    virtual void update_neighbor(long long neighbor, float new_value, long long parent);
+
+    /**
+     * @brief Insère une cellule dans la frontière ou diminue sa clé, en tenant les compteurs à jour
+     */
+    void push_front(long long index, float key);
+
+    /**
+     * @brief Cellules initialisées par une liste de points et leur valeur initiale
+     * Point entier : (cellule, 0) ; point flottant : coins de son hypercube et leur distance.
      */
-    virtual void update_neighbor(Point* neighbor, float new_value, Point* parent);
+    std::vector<std::pair<long long, float>> seed_cells(const std::vector<std::vector<float>>& points) const;
 
     /**
      * @brief Calcule la valeur interpolée à un point flottant
@@ -108,10 +251,83 @@ protected:
      */
     float get_interpolated_value(const std::vector<float>& coords) const;
 
-   virtual void initialize_floating_start(const std::vector<float>& coords);
+    /**
+     * @brief Vérifie si tous les coins d'un hypercube ont été traités (état FROZEN)
+     * @param coords Coordonnées du point flottant
+     * @return true si tous les coins sont FROZEN
+     */
+    bool are_all_corners_frozen(const std::vector<float>& coords) const;
 
-private:
-    int processed_count; ///< Compteur de points traités
+   virtual void initialize_floating_start(const std::vector<float>& coords);
 };
 
+template <typename Func>
+void GraphSearchBase::for_each_neighbor(long long index, Func&& func) const
+{
+    if (neighborhood) {
+        // Stencil précalculé (diagonales, rayon euclidien...)
+        neighborhood->for_each_neigh(*env, index, func);
+        return;
+    }
+
+    // Voisins axiaux (buffer local : aucune allocation par appel)
+    long long neighbors[Environnement::MAX_AXIS_NEIGHBORS];
+    int neighbor_count = env->get_neigh(index, neighbors);
+    for (int k = 0; k < neighbor_count; k++) {
+        func(neighbors[k], 1.0f);
+    }
+}
+
+template <typename Update, typename Priority>
+bool GraphSearchBase::run_fixed_dimension(Update&& update, Priority&& priority)
+{
+    if (!fixed_dimension_kernels || neighborhood || env->get_backend() != Environnement::DENSE) {
+        return false;
+    }
+    switch (env->get_shape().get_dim()) {
+        case 2: run_axial_kernel<2>(update, priority); return true;
+        case 3: run_axial_kernel<3>(update, priority); return true;
+        default: return false;
+    }
+}
+
+template <typename Update>
+bool GraphSearchBase::run_fixed_dimension(Update&& update)
+{
+    return run_fixed_dimension(update, [](const auto&, long long, const auto&, float value) { return value; });
+}
+
+template <int N, typename Update, typename Priority>
+void GraphSearchBase::run_axial_kernel(Update& update, Priority& priority)
+{
+    const FixedGrid<N> grid(*env);
+
+    while (should_continue()) {
+        long long current = front->pop().index;
+        stats.pops++;
+        workspace.set_state(current, FROZEN);
+        stats.expansions++;
+
+        const typename FixedGrid<N>::Coords c = grid.coords(current);
+        for (int axis = 0; axis < N; axis++) {
+            for (int direction = -1; direction <= 1; direction += 2) {
+                long long neighbor = grid.neighbor(current, c, axis, direction);
+                if (neighbor < 0 || grid.is_obstacle(neighbor) || workspace.get_state(neighbor) == FROZEN) continue;
+
+                typename FixedGrid<N>::Coords neighbor_coords = c;
+                neighbor_coords[axis] = c[axis] + direction < 0 ? grid.size(axis) - 1
+                                      : (c[axis] + direction >= grid.size(axis) ? 0 : c[axis] + direction);
+
+                float new_value = update(grid, current, neighbor, neighbor_coords);
+                if (workspace.get_state(neighbor) == FAR || new_value < workspace.get_value(neighbor)) {
+                    workspace.set_value(neighbor, new_value);
+                    workspace.set_parent(neighbor, current);
+                    workspace.set_state(neighbor, FRONT);
+                    push_front(neighbor, priority(grid, neighbor, neighbor_coords, new_value));
+                }
+            }
+        }
+    }
+}
+
 #endif // GRAPHSEARCHBASE_HPP
\ No newline at end of file
@@ -0,0 +1,182 @@
+#ifndef HPASTAR_HPP
+#define HPASTAR_HPP
+
+#include "Dijkstra.hpp"
+#include "../../Environnement.hpp"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Abstraction hiérarchique d'un Environnement en clusters (HPA*)
+ *
+ * La grille est découpée en clusters (hyper-rectangles de côté cluster_size). Sur chaque
+ * face commune à deux clusters voisins, les paires de cellules libres face à face forment
+ * des entrées (composantes connexes de la face) ; chaque entrée donne une transition au
+ * milieu, ou deux transitions aux extrémités pour une entrée longue. Les distances entre
+ * les cellules d'entrée d'un même cluster sont calculées par Dijkstra sur le seul cluster.
+ *
+ * Graphe abstrait : nœuds = cellules d'entrée, arêtes = transitions entre clusters
+ * (coût d'une arête) et distances intra-cluster. Le prétraitement ne coûte que des
+ * recherches de la taille d'un cluster ; rebuild_cluster() / update_cells() le refont
+ * localement après une modification des obstacles.
+ *
+ * USAGE: requêtes longue distance sur grandes cartes, voisins axiaux, non périodique,
+ * coût uniforme (le champ de coût de l'environnement est ignoré).
+ */
+class ClusterAbstraction
+{
+public:
+    /**
+     * @brief Arête du graphe abstrait
+     */
+    struct Edge {
+        int target;  ///< Nœud d'arrivée
+        float cost;  ///< Longueur
+    };
+
+    /**
+     * @brief Dijkstra restreint à une boîte de la grille
+     *
+     * Copie les obstacles de la boîte dans un Environnement DENSE local et y lance Dijkstra :
+     * le coût ne dépend que de la taille de la boîte, pas de celle de la carte.
+     */
+    class LocalSearch
+    {
+    private:
+        const Environnement* env;
+        std::vector<int> lower;  ///< Coin inférieur inclus
+        std::vector<int> upper;  ///< Coin supérieur exclu
+        std::unique_ptr<Environnement> local;
+        std::unique_ptr<Dijkstra> dijkstra;
+
+    public:
+        LocalSearch(const Environnement& environment, const std::vector<int>& box_lower,
+                    const std::vector<int>& box_upper, float edge_cost);
+
+        /**
+         * @brief Distances depuis une cellule (index global) à toute la boîte
+         */
+        void run(long long source);
+
+        /**
+         * @brief Distance de la source à une cellule (INFINITY hors de la boîte ou non atteinte)
+         */
+        float distance(long long cell) const;
+
+        /**
+         * @brief Chemin source -> cellule en index globaux (vide si non atteinte)
+         */
+        std::vector<long long> path_to(long long cell) const;
+
+        long long get_expansions() const { return dijkstra->get_statistics().expansions; }
+
+    private:
+        long long to_local(long long cell) const;
+        long long to_global(long long local_index) const;
+    };
+
+    static constexpr int LONG_ENTRANCE = 6; ///< À partir de cette taille, une entrée a deux transitions
+
+private:
+    const Environnement* env;
+    int cluster_size;
+    float edge_cost;
+    GridShape cluster_shape;  ///< Grille des clusters
+    std::vector<std::vector<std::pair<long long, long long>>> transitions; ///< [cluster * dim + axe] : vers le cluster suivant
+    std::vector<std::vector<long long>> entrances;   ///< [cluster] : cellules d'entrée, triées
+    std::vector<std::vector<float>> intra_distances; ///< [cluster] : matrice entrées x entrées
+    std::vector<long long> node_cells;               ///< Cellule de chaque nœud abstrait
+    std::unordered_map<long long, int> node_of_cell;
+    std::vector<std::vector<Edge>> edges;
+    long long preprocessing_expansions;              ///< Expansions des recherches intra-cluster
+
+public:
+    /**
+     * @brief Constructeur (n'effectue pas le prétraitement, voir build())
+     * @param environment Environnement (non périodique)
+     * @param size Côté d'un cluster en cellules
+     * @param cost Coût d'une arête
+     */
+    ClusterAbstraction(const Environnement* environment, int size, float cost = 1.0f);
+
+    /**
+     * @brief Calcule toutes les entrées, distances intra-cluster et le graphe abstrait
+     */
+    void build();
+
+    /**
+     * @brief Recalcule les faces d'un cluster, ses distances et celles de ses voisins
+     */
+    void rebuild_cluster(long long cluster);
+
+    /**
+     * @brief Recalcule les clusters contenant des cellules dont l'état d'obstacle a changé
+     */
+    void update_cells(const std::vector<long long>& cells);
+
+    const Environnement& get_environment() const { return *env; }
+    int get_cluster_size() const { return cluster_size; }
+    float get_edge_cost() const { return edge_cost; }
+    long long get_cluster_count() const { return cluster_shape.get_total(); }
+    long long cluster_of(long long cell) const;
+    void cluster_bounds(long long cluster, std::vector<int>& lower, std::vector<int>& upper) const;
+    const std::vector<long long>& get_entrances(long long cluster) const { return entrances[cluster]; }
+
+    int get_node_count() const { return static_cast<int>(node_cells.size()); }
+    long long get_node_cell(int node) const { return node_cells[node]; }
+    int node_of(long long cell) const;
+    const std::vector<Edge>& get_edges(int node) const { return edges[node]; }
+    long long get_preprocessing_expansions() const { return preprocessing_expansions; }
+
+private:
+    bool is_free(long long cell) const;
+    void compute_face(long long cluster, int axis);
+    void compute_cluster(long long cluster);
+    void rebuild_graph();
+};
+
+/**
+ * @brief Compteurs d'une requête HPA*
+ */
+struct HPAStatistics {
+    long long abstract_expansions = 0; ///< Nœuds développés dans le graphe abstrait
+    long long local_expansions = 0;    ///< Cellules développées (insertion départ / arrivée et raffinement)
+};
+
+/**
+ * @brief Requête HPA* sur une ClusterAbstraction
+ *
+ * Le départ et l'arrivée sont reliés aux entrées de leur cluster par Dijkstra local,
+ * le graphe abstrait est parcouru par A* (heuristique de Manhattan), puis seuls les
+ * clusters traversés sont raffinés en chemin cellule par cellule. Le chemin est
+ * quasi optimal : il ne passe que par les transitions de l'abstraction.
+ */
+class HPAStar
+{
+private:
+    const ClusterAbstraction* abstraction;
+    std::vector<long long> path;
+    std::vector<long long> abstract_path;
+    float cost;
+    HPAStatistics stats;
+
+public:
+    explicit HPAStar(const ClusterAbstraction* cluster_abstraction);
+
+    /**
+     * @brief Cherche un chemin entre deux cellules (coordonnées entières)
+     * @return false si aucun chemin n'existe dans l'abstraction
+     */
+    bool find_path(const std::vector<float>& start, const std::vector<float>& goal);
+
+    const std::vector<long long>& get_path() const { return path; }
+    const std::vector<long long>& get_abstract_path() const { return abstract_path; }
+    float get_cost() const { return cost; }
+    const HPAStatistics& get_statistics() const { return stats; }
+
+private:
+    float estimate(long long cell, long long goal) const;
+};
+
+#endif // HPASTAR_HPP
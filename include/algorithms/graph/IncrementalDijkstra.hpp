@@ -0,0 +1,84 @@
+#ifndef INCREMENTALDIJKSTRA_HPP
+#define INCREMENTALDIJKSTRA_HPP
+
+#include "Dijkstra.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Dijkstra incrémental (Lifelong Planning A* sans heuristique) pour une source fixe
+ *
+ * Le premier execute() est un Dijkstra complet ; ensuite l'état est conservé. Les cellules
+ * dont l'état d'obstacle ou le coût (Environnement::set_cost) a changé dans l'environnement
+ * sont signalées par update_cells() et le execute() suivant ne traite que les cellules
+ * devenues incohérentes (une arête coûte pas × moyenne des coûts de ses extrémités : la
+ * cellule et ses voisins suffisent) :
+ * rhs(s) = min(valeur de départ, min sur les voisins p de calculate_new_value(p, s)),
+ * et une cellule est dans la frontière (clé min(g, rhs)) tant que g(s) != rhs(s).
+ * Une cellule surcohérente (g > rhs) reçoit g = rhs ; une cellule sous-cohérente
+ * (g < rhs, chemin coupé) repasse à l'infini et ses descendants sont recalculés.
+ * Un changement des départs ne met à jour que les anciennes et nouvelles cellules de départ.
+ *
+ * Le champ obtenu est identique à celui d'un Dijkstra complet. Un changement de coût
+ * d'arête ou de voisinage, le remplacement du champ de coût entier (set_cost_field,
+ * clear_cost_field, chargements), une autre politique que DARY_HEAP (les clés remontent) ou
+ * un voisinage à cellules traversées relancent un calcul complet.
+ */
+class IncrementalDijkstra : public Dijkstra
+{
+private:
+    std::vector<float> rhs;                                ///< Valeur anticipée de chaque cellule
+    std::vector<std::pair<long long, float>> seeds;        ///< Cellules de départ et leur valeur
+    std::vector<long long> pending;                        ///< Cellules modifiées depuis le dernier execute()
+    bool solved;                                           ///< Un champ cohérent est disponible
+    float solved_cost;                                     ///< Coût d'arête du champ courant
+    std::uint64_t solved_cost_field_version;               ///< Version du champ de coût entier de l'environnement
+    const NeighborhoodStrategy* solved_neighborhood;       ///< Voisinage du champ courant
+    bool last_incremental;                                 ///< Le dernier execute() a été une réparation
+
+public:
+    /**
+     * @brief Constructeur
+     * @param environment Pointeur vers l'environnement
+     * @param cost Coût d'une arête (défaut: 1.0)
+     */
+    explicit IncrementalDijkstra(Environnement* environment, float cost = 1.0f);
+
+    virtual ~IncrementalDijkstra() = default;
+
+    /**
+     * @brief Calcul complet au premier appel, réparation des cellules signalées ensuite
+     */
+    virtual void execute() override;
+
+    /**
+     * @brief Signale des cellules dont l'état d'obstacle ou le coût a changé (déjà appliqué à l'environnement)
+     * Prises en compte au prochain execute().
+     */
+    void update_cells(const std::vector<long long>& cells);
+
+    /**
+     * @brief Oublie le champ courant : le prochain execute() fait un calcul complet
+     */
+    void invalidate() { solved = false; }
+
+    bool is_solved() const { return solved; }
+    bool was_incremental() const { return last_incremental; }
+    float get_rhs(long long index) const { return rhs[index]; }
+
+protected:
+    /**
+     * @brief Départs du calcul complet (mémorisés comme valeurs de départ de rhs)
+     */
+    virtual void initialize_starts() override;
+
+private:
+    bool can_repair() const;
+    bool is_free(long long index) const;
+    void refresh(long long index);
+    void update_vertex(long long index);
+    void repair();
+};
+
+#endif // INCREMENTALDIJKSTRA_HPP
@@ -0,0 +1,92 @@
+#ifndef INCREMENTALFMM_HPP
+#define INCREMENTALFMM_HPP
+
+#include "FMM.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief FMM incrémental : re-propagation locale après modification d'obstacles
+ *
+ * Le premier execute() est un FMM complet ; ensuite le champ est conservé. Les cellules
+ * dont l'état d'obstacle a changé sont signalées par update_cells() et le execute() suivant :
+ *  1. invalide la région dépendante : fermeture des cellules dont une valeur amont
+ *     (minimum d'un axe du schéma Eikonal) appartient à la région, à partir des cellules modifiées ;
+ *  2. réinitialise cette région depuis sa bordure valide (et les départs qu'elle contient) ;
+ *  3. la re-propage par marche rapide ; une cellule hors région dont la valeur baisse nettement
+ *     (obstacle retiré) rejoint la marche, ce qui propage les diminutions au-delà de la région.
+ *
+ * Seules la région invalidée et les cellules qui s'améliorent sont traitées. L'accessibilité
+ * est identique à celle d'un FMM complet, et les valeurs aussi aux arrondis près :
+ * solve_eikonal n'utilise que les axes amont, le résultat ne dépend pas de l'ordre des mises à jour.
+ * Un changement de coût (scalaire ou champ de l'environnement), un voisinage (stencil), le schéma SECOND_ORDER
+ * ou une autre politique que DARY_HEAP relancent un calcul complet.
+ */
+class IncrementalFMM : public FMM
+{
+private:
+    std::vector<std::pair<long long, float>> seeds; ///< Cellules de départ et leur valeur
+    std::vector<long long> pending;                 ///< Cellules modifiées depuis le dernier execute()
+    std::vector<std::uint8_t> in_region;            ///< Cellule recalculée par la réparation en cours
+    std::vector<long long> region;                  ///< Cellules marquées dans in_region
+    bool solved;                                    ///< Un champ est disponible
+    float solved_cost;                              ///< Coût par unité de distance du champ courant
+    std::uint64_t solved_cost_version;              ///< Version du champ de coût de l'environnement
+    bool last_incremental;                          ///< Le dernier execute() a été une réparation
+
+public:
+    /**
+     * @brief Constructeur
+     * @param environment Pointeur vers l'environnement
+     * @param cost Coût par unité de distance (défaut: 1.0)
+     */
+    explicit IncrementalFMM(Environnement* environment, float cost = 1.0f);
+
+    virtual ~IncrementalFMM() = default;
+
+    /**
+     * @brief Calcul complet au premier appel, réparation locale ensuite
+     */
+    virtual void execute() override;
+
+    /**
+     * @brief Signale des cellules dont l'état d'obstacle a changé (déjà appliqué à l'environnement)
+     * Prises en compte au prochain execute().
+     */
+    void update_cells(const std::vector<long long>& cells);
+
+    /**
+     * @brief Oublie le champ courant : le prochain execute() fait un calcul complet
+     */
+    void invalidate() { solved = false; }
+
+    bool is_solved() const { return solved; }
+    bool was_incremental() const { return last_incremental; }
+
+    /**
+     * @brief Nombre de cellules invalidées ou améliorées par la dernière réparation
+     */
+    long long get_repaired_count() const { return static_cast<long long>(region.size()); }
+
+protected:
+    /**
+     * @brief Départs du calcul complet (mémorisés pour les réparations)
+     */
+    virtual void initialize_starts() override;
+
+private:
+    bool can_repair() const;
+    bool is_free(long long index) const;
+
+    /**
+     * @brief Vrai si la valeur de cell utilise celle de upwind (minimum d'un de ses axes)
+     */
+    bool depends_on(long long cell, long long upwind) const;
+
+    void mark(long long index);
+    void invalidate_region();
+    void repair();
+};
+
+#endif // INCREMENTALFMM_HPP
@@ -0,0 +1,113 @@
+#ifndef JPS_HPP
+#define JPS_HPP
+
+#include "AStar.hpp"
+#include "JumpPointTable.hpp"
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Jump Point Search : A* 8-connexe à coût uniforme sans chemins symétriques
+ *
+ * Au lieu de pousser les 8 voisins, chaque expansion « saute » en ligne droite ou en
+ * diagonale jusqu'à la prochaine cellule ayant un voisin forcé (ou une arrivée) et
+ * n'insère que ces points de saut. Les coûts sont ceux de Dijkstra / A* avec
+ * GridNeighbors(FULL) : 1 en orthogonal, √2 en diagonal (× coût d'arête), coins coupables.
+ *
+ * Reprend l'heuristique (HeuristicStrategy, OctileHeuristic par défaut) et la gestion des
+ * arrivées d'AStar. Les valeurs U ne sont définies qu'aux points de saut ; extract_path()
+ * reconstruit le chemin cellule par cellule.
+ *
+ * USAGE: grilles 2D non périodiques, coût uniforme. Le voisinage (set_neighborhood) est ignoré.
+ */
+class JPS : public AStar
+{
+protected:
+    OctileHeuristic default_heuristic; ///< Heuristique utilisée si aucune n'est fournie
+    JumpGrid grid;                     ///< Vue 2D de l'environnement
+    std::vector<long long> jump_targets; ///< Cellules où un saut s'arrête (arrivées et coins d'arrivées flottantes)
+
+public:
+    /**
+     * @brief Constructeur
+     * @param environment Pointeur vers l'environnement (2D, non périodique)
+     * @param cost Coût d'une arête orthogonale (défaut: 1.0)
+     * @param heuristic_strat Heuristique (nullptr : OctileHeuristic)
+     */
+    explicit JPS(Environnement* environment, float cost = 1.0f, HeuristicStrategy* heuristic_strat = nullptr);
+
+    virtual ~JPS() = default;
+
+    /**
+     * @brief Chemin complet (index linéaires, départ en tête) jusqu'à une arrivée atteinte
+     * @return Vide si l'arrivée n'a pas été atteinte
+     */
+    std::vector<long long> extract_path(const std::vector<float>& goal) const;
+
+protected:
+    virtual void initialize_starts() override;
+
+    /**
+     * @brief Développe les directions élaguées et relâche les points de saut trouvés
+     */
+    virtual void process_point(long long current) override;
+
+    /**
+     * @brief Pas de noyau spécialisé : la boucle générique appelle process_point()
+     */
+    virtual bool run_fixed_dimension_loop() override { return false; }
+
+    /**
+     * @brief Saute depuis (x, y) dans une direction
+     * @param steps Nombre de pas jusqu'au point de saut trouvé
+     * @return true si un point de saut a été trouvé
+     */
+    virtual bool jump(int x, int y, int direction, int& steps) const;
+
+    bool is_target(long long index) const;
+
+private:
+    bool jump_straight(int x, int y, int dx, int dy, int& steps) const;
+};
+
+/**
+ * @brief JPS+ : distances de saut précalculées, chaque saut est une lecture de table
+ *
+ * La table (JumpPointTable) ne dépend que des obstacles. execute() la construit si aucune
+ * table n'a été fournie, ou la reconstruit si la version des obstacles a changé depuis son
+ * calcul (vérification en O(1) par requête) ; elle peut être partagée entre plusieurs
+ * recherches sur le même environnement. Les arrivées sont détectées à la volée
+ * (arrivée sur la ligne ou dans le quadrant d'un saut).
+ */
+class JPSPlus : public JPS
+{
+private:
+    std::shared_ptr<const JumpPointTable> table;
+
+public:
+    explicit JPSPlus(Environnement* environment, float cost = 1.0f, HeuristicStrategy* heuristic_strat = nullptr);
+
+    virtual ~JPSPlus() = default;
+
+    /**
+     * @brief Utilise une table déjà calculée pour cet environnement
+     * @throws std::invalid_argument si la table ne correspond pas à ses obstacles actuels
+     */
+    void set_jump_table(std::shared_ptr<const JumpPointTable> jump_table);
+
+    /**
+     * @brief Table courante (nullptr avant le premier execute())
+     */
+    std::shared_ptr<const JumpPointTable> get_jump_table() const { return table; }
+
+    /**
+     * @brief Recalcule la table (fait aussi par execute() si les obstacles ont changé)
+     */
+    void rebuild_jump_table();
+
+protected:
+    virtual void initialize_starts() override;
+    virtual bool jump(int x, int y, int direction, int& steps) const override;
+};
+
+#endif // JPS_HPP
@@ -0,0 +1,116 @@
+#ifndef JUMPPOINTTABLE_HPP
+#define JUMPPOINTTABLE_HPP
+
+#include "../../Environnement.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Vue 2D d'un environnement pour Jump Point Search (8-connexe, coins coupables)
+ *
+ * Regroupe le test de franchissabilité et la règle des voisins forcés, communs à la
+ * recherche en ligne (JPS) et au précalcul des distances de saut (JumpPointTable).
+ * Les directions sont numérotées de 0 à 7 dans le sens trigonométrique à partir de (1, 0).
+ */
+class JumpGrid
+{
+public:
+    static constexpr int DIRECTIONS = 8;
+    static const int DX[DIRECTIONS];
+    static const int DY[DIRECTIONS];
+
+private:
+    const Environnement* env;
+    const unsigned char* obstacles; ///< Grille d'obstacles DENSE (nullptr pour MAP)
+    int width;
+    int height;
+    long long stride_x;
+    long long stride_y;
+
+public:
+    JumpGrid();
+
+    /**
+     * @brief Construit la vue d'un environnement 2D non périodique
+     * @throws std::invalid_argument si l'environnement n'est pas 2D ou est périodique
+     */
+    explicit JumpGrid(const Environnement& environment);
+
+    int get_width() const { return width; }
+    int get_height() const { return height; }
+
+    long long index_of(int x, int y) const { return x * stride_x + y * stride_y; }
+    int x_of(long long index) const { return static_cast<int>((index / stride_x) % width); }
+    int y_of(long long index) const { return static_cast<int>((index / stride_y) % height); }
+
+    /**
+     * @brief Cellule dans la grille, existante et libre
+     */
+    bool walkable(int x, int y) const
+    {
+        if (x < 0 || y < 0 || x >= width || y >= height) return false;
+        long long index = index_of(x, y);
+        if (obstacles) return obstacles[index] == 0;
+        return env->has_index(index) && !env->is_obstacle(index);
+    }
+
+    /**
+     * @brief La cellule (x, y), atteinte dans la direction (dx, dy), a-t-elle un voisin forcé ?
+     */
+    bool has_forced_neighbor(int x, int y, int dx, int dy) const;
+
+    /**
+     * @brief Directions à explorer depuis (x, y) atteint dans la direction (dx, dy)
+     * Sans direction d'arrivée (dx = dy = 0) : les 8 directions.
+     * @param directions Tampon d'au moins DIRECTIONS entrées
+     * @return Nombre de directions écrites
+     */
+    int successor_directions(int x, int y, int dx, int dy, int* directions) const;
+
+    /**
+     * @brief Numéro de la direction (dx, dy), -1 pour (0, 0)
+     */
+    static int direction_of(int dx, int dy);
+};
+
+/**
+ * @brief Distances de saut précalculées de JPS+ (une entrée par cellule et par direction)
+ *
+ * Pour une cellule libre et une direction d : une valeur k > 0 signifie qu'un point de saut
+ * se trouve k pas plus loin ; une valeur k <= 0 que -k pas libres précèdent un mur ou le bord.
+ * La table ne dépend que des obstacles : elle se calcule une fois par environnement et se
+ * partage entre recherches (JPSPlus::set_jump_table). Elle mémorise la version des
+ * obstacles (Environnement::get_obstacle_version) : une table d'une autre carte, ou
+ * d'une carte modifiée depuis, n'est plus reconnue par matches().
+ */
+class JumpPointTable
+{
+private:
+    JumpGrid grid;
+    std::vector<int> distances; ///< distances[index * DIRECTIONS + direction]
+    std::uint64_t obstacle_version; ///< Version des obstacles au moment du calcul
+
+public:
+    /**
+     * @brief Précalcule les distances de saut par programmation dynamique (O(cellules))
+     */
+    explicit JumpPointTable(const Environnement& environment);
+
+    int get_distance(long long index, int direction) const
+    {
+        return distances[index * JumpGrid::DIRECTIONS + direction];
+    }
+
+    const JumpGrid& get_grid() const { return grid; }
+
+    /**
+     * @brief La table correspond-elle à la forme et aux obstacles actuels de cet environnement ?
+     * Compare la version des obstacles : O(1).
+     */
+    bool matches(const Environnement& environment) const;
+
+private:
+    void fill_direction(int direction);
+};
+
+#endif // JUMPPOINTTABLE_HPP
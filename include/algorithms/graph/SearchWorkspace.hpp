@@ -0,0 +1,57 @@
+#ifndef SEARCHWORKSPACE_HPP
+#define SEARCHWORKSPACE_HPP
+
+#include "../../Point.hpp"
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief État d'une requête de recherche, stocké en structure de tableaux (SoA)
+ *
+ * Chaque cellule de la grille est repérée par son index linéaire
+ * (Environnement::coordinatesToIndex). La valeur U, l'état et le parent de
+ * chaque cellule vivent dans trois tableaux contigus, séparés de la géométrie
+ * de l'environnement : plusieurs recherches peuvent ainsi partager une même
+ * carte en lecture seule.
+ */
+class SearchWorkspace
+{
+public:
+    static constexpr std::uint32_t NO_PARENT = std::numeric_limits<std::uint32_t>::max();
+
+private:
+    std::vector<float> values;         ///< Valeur U de chaque cellule
+    std::vector<std::uint8_t> states;  ///< State (FROZEN, FRONT, FAR) de chaque cellule
+    std::vector<std::uint32_t> parents; ///< Index du parent, NO_PARENT si aucun
+
+public:
+    SearchWorkspace() = default;
+
+    /**
+     * @brief Dimensionne les tableaux et remet toutes les cellules à FAR / INFINITY
+     * @param cell_count Nombre total de cellules de la grille
+     */
+    void resize(long long cell_count);
+
+    /**
+     * @brief Remet toutes les cellules à FAR / INFINITY sans réallouer
+     */
+    void reset();
+
+    long long size() const { return static_cast<long long>(values.size()); }
+
+    // Accesseurs
+    float get_value(long long index) const { return values[index]; }
+    State get_state(long long index) const { return static_cast<State>(states[index]); }
+    std::uint32_t get_parent(long long index) const { return parents[index]; }
+    bool has_parent(long long index) const { return parents[index] != NO_PARENT; }
+
+    // Mutateurs
+    void set_value(long long index, float v) { values[index] = v; }
+    void set_state(long long index, State s) { states[index] = static_cast<std::uint8_t>(s); }
+    void set_parent(long long index, long long parent) { parents[index] = static_cast<std::uint32_t>(parent); }
+    void clear_parent(long long index) { parents[index] = NO_PARENT; }
+};
+
+#endif // SEARCHWORKSPACE_HPP
@@ -0,0 +1,380 @@
+#ifndef STATICASTAR_HPP
+#define STATICASTAR_HPP
+
+#include "GraphSearchBase.hpp"
+#include "../strategies/StaticHeuristics.hpp"
+#include <vector>
+#include <limits>
+#include <set>
+#include <tuple>
+#include <cmath>
+#include <cstdint>
+#include <climits>
+#include <stdexcept>
+
+/**
+ * @brief Mode de recherche de StaticAStar / AStar
+ *
+ * Pour les modes sous-optimaux bornés, w >= 1 est le facteur fixé par set_suboptimality() :
+ * avec une heuristique admissible et cohérente (non pondérée), le chemin trouvé coûte au
+ * plus w fois l'optimum.
+ */
+enum SuboptimalityMode {
+    OPTIMAL_SEARCH,    ///< A* classique, clé g + h
+    WEIGHTED_ASTAR,    ///< A* pondéré, clé g + w * h (sans ré-ouverture, borne garantie si h cohérente)
+    DYNAMIC_WEIGHTING, ///< Poids dynamique (Pohl) : clé g + (1 + (w - 1) * max(0, 1 - g / h0)) * h, ré-ouverture
+    FOCAL_SEARCH       ///< A*-epsilon : parmi les cellules de f <= w * f_min, celle de plus petit h, ré-ouverture
+};
+
+/**
+ * @brief A* à heuristique statique : le type de l'heuristique est un paramètre template
+ *
+ * L'heuristique (voir StaticHeuristics.hpp) est appelée directement, sans appel virtuel
+ * ni copie de coordonnées : le compilateur l'inline dans la boucle spécialisée 2D / 3D.
+ * AStar est cette classe instanciée avec StrategyHeuristic (interface virtuelle).
+ *
+ * La valeur U d'une cellule est g(n), le coût depuis le départ ; la clé de la frontière
+ * est f(n) = g(n) + h(n), avec h(n) le minimum de l'heuristique sur les points d'arrivée.
+ *
+ * set_suboptimality() échange l'optimalité contre beaucoup moins d'expansions : le
+ * facteur w y est la borne garantie (get_suboptimality_bound()), plutôt qu'un poids passé
+ * à l'heuristique (EuclideanHeuristic(weight)) dont is_admissible() ne dit que « non ».
+ * Les modes DYNAMIC_WEIGHTING et FOCAL_SEARCH ré-ouvrent les cellules dont g baisse et
+ * utilisent la boucle générique ; WEIGHTED_ASTAR garde les boucles spécialisées.
+ *
+ * Frontières acceptées : DARY_HEAP, et RADIX_HEAP en modes OPTIMAL_SEARCH et FOCAL_SEARCH
+ * (clés f monotones avec une heuristique cohérente). Les seaux sont refusés.
+ *
+ * Le coût d'une arête est edge_cost × longueur : un champ de coût de l'environnement
+ * (Environnement::set_cost_field) n'est pas pris en compte et fait échouer execute().
+ *
+ * Exemple:
+ *     StaticAStar<EuclideanDistance> astar(&env);
+ *     StaticAStar<MaxOf<ManhattanDistance, OctileDistance>> combined(&env);
+ *     astar.set_suboptimality(FOCAL_SEARCH, 1.05f); // au plus 5 % au-dessus de l'optimum
+ */
+template <typename Heuristic>
+class StaticAStar : public GraphSearchBase
+{
+protected:
+    float edge_cost;                  ///< Coût d'une arête (par défaut 1.0 pour grille uniforme)
+    Heuristic heuristic;              ///< Heuristique, appelée sans indirection
+    DynamicGrid dynamic_grid;         ///< Vue de la grille pour la boucle générique
+    std::vector<long long> goal_cells; ///< Cellule de chaque point d'arrivée (coordonnées tronquées)
+    std::vector<std::vector<long long>> goal_corners; ///< Coins de l'hypercube de chaque point d'arrivée
+    SuboptimalityMode suboptimality_mode; ///< Mode de recherche
+    float suboptimality_factor;       ///< Facteur w des modes bornés (>= 1)
+    float dynamic_horizon;            ///< h0 : heuristique des départs (DYNAMIC_WEIGHTING)
+
+public:
+    /**
+     * @brief Constructeur
+     * @param environment Pointeur vers l'environnement
+     * @param cost Coût d'une arête (défaut: 1.0)
+     * @param h Heuristique
+     */
+    explicit StaticAStar(Environnement* environment, float cost = 1.0f, Heuristic h = Heuristic())
+        : GraphSearchBase(environment), edge_cost(cost), heuristic(h), suboptimality_mode(OPTIMAL_SEARCH),
+          suboptimality_factor(1.0f), dynamic_horizon(0.0f) {}
+
+    virtual ~StaticAStar() = default;
+
+    void set_edge_cost(float cost) { edge_cost = cost; }
+    float get_edge_cost() const { return edge_cost; }
+
+    void set_heuristic(const Heuristic& h) { heuristic = h; }
+    const Heuristic& get_heuristic() const { return heuristic; }
+
+    /**
+     * @brief Choisit le mode de recherche et son facteur de sous-optimalité
+     * @param mode Mode de recherche (OPTIMAL_SEARCH ignore le facteur)
+     * @param factor Facteur w >= 1 : le chemin coûte au plus w fois l'optimum
+     * @throws std::invalid_argument si factor < 1
+     */
+    void set_suboptimality(SuboptimalityMode mode, float factor = 1.0f)
+    {
+        if (!(factor >= 1.0f)) {
+            throw std::invalid_argument("StaticAStar::set_suboptimality: factor must be >= 1.0.");
+        }
+        suboptimality_mode = mode;
+        suboptimality_factor = mode == OPTIMAL_SEARCH ? 1.0f : factor;
+    }
+
+    SuboptimalityMode get_suboptimality_mode() const { return suboptimality_mode; }
+
+    /**
+     * @brief Borne garantie : coût trouvé <= borne × coût optimal (heuristique admissible et cohérente)
+     */
+    float get_suboptimality_bound() const { return suboptimality_factor; }
+
+    /**
+     * @brief Heuristique d'une cellule : minimum sur les points d'arrivée (0 sans arrivée)
+     */
+    template <typename Grid, typename Coords>
+    float estimate(const Grid& grid, long long index, const Coords& coords) const
+    {
+        if (ends.empty()) return 0.0f;
+        float best = std::numeric_limits<float>::infinity();
+        for (const auto& goal : ends) {
+            float h = heuristic(grid, index, coords, goal);
+            if (h < best) best = h;
+        }
+        return best;
+    }
+
+protected:
+    /**
+     * @brief g(voisin) = g(courant) + coût_arête * longueur_arête
+     */
+    virtual float calculate_new_value(long long current, long long neighbor, float step_length) override
+    {
+        (void)neighbor;
+        return workspace.get_value(current) + edge_cost * step_length;
+    }
+
+    /**
+     * @brief Poids de l'heuristique pour une cellule de valeur g (1 en mode OPTIMAL_SEARCH)
+     */
+    float inflation(float value) const
+    {
+        switch (suboptimality_mode) {
+            case WEIGHTED_ASTAR:
+                return suboptimality_factor;
+            case DYNAMIC_WEIGHTING: {
+                // Poids maximal au départ, ramené à 1 à mesure que g approche h0
+                float remaining = dynamic_horizon > 0.0f ? std::max(0.0f, 1.0f - value / dynamic_horizon) : 0.0f;
+                return 1.0f + (suboptimality_factor - 1.0f) * remaining;
+            }
+            default:
+                return 1.0f;
+        }
+    }
+
+    /**
+     * @brief f(n) = g(n) + h(n), h pondéré selon le mode
+     */
+    virtual float get_priority(long long index, float value) const override
+    {
+        return value + inflation(value) * estimate(dynamic_grid, index, dynamic_grid.coords(index));
+    }
+
+    /**
+     * @brief Prépare la vue de grille et les cellules d'arrivée avant d'insérer les départs
+     * @throws std::logic_error pour une frontière à seaux (DIAL_BUCKETS / UNTIDY_BUCKETS) : le coût
+     * réduit c - h(u) + h(v) d'une arête peut être presque nul, l'ordre dans un seau n'est plus exact
+     * @throws std::logic_error si l'environnement a un champ de coût (les heuristiques supposent un coût uniforme)
+     */
+    virtual void initialize_starts() override
+    {
+        if (env->has_cost_field()) {
+            throw std::logic_error("StaticAStar: cost fields are not supported, use Dijkstra or FMM.");
+        }
+        if (queue_policy == DIAL_BUCKETS || queue_policy == UNTIDY_BUCKETS) {
+            throw std::logic_error("StaticAStar: heuristic keys are not exact with bucket queues.");
+        }
+        if ((suboptimality_mode == WEIGHTED_ASTAR || suboptimality_mode == DYNAMIC_WEIGHTING) &&
+            queue_policy != DARY_HEAP) {
+            throw std::logic_error("StaticAStar: inflated keys require the DARY_HEAP queue policy.");
+        }
+        dynamic_grid = DynamicGrid(*env);
+        goal_cells.clear();
+        goal_corners.clear();
+        const GridShape& shape = env->get_shape();
+        for (const auto& end_coords : ends) {
+            std::vector<long long> corners;
+            for (const auto& corner : env->get_hypercube_corners_with_weights(end_coords)) {
+                corners.push_back(corner.first);
+            }
+            if (!corners.empty()) goal_corners.push_back(corners);
+
+            long long index = 0;
+            bool inside = end_coords.size() == static_cast<size_t>(shape.get_dim());
+            for (int i = 0; inside && i < shape.get_dim(); i++) {
+                int c = static_cast<int>(end_coords[i]);
+                inside = c >= 0 && c < shape.size(i);
+                index += c * shape.stride(i);
+            }
+            if (inside) goal_cells.push_back(index);
+        }
+
+        dynamic_horizon = 0.0f;
+        if (suboptimality_mode == DYNAMIC_WEIGHTING) {
+            for (const auto& seed : seed_cells(starts)) {
+                dynamic_horizon = std::max(dynamic_horizon, estimate(dynamic_grid, seed.first, dynamic_grid.coords(seed.first)));
+            }
+        }
+        GraphSearchBase::initialize_starts();
+    }
+
+    /**
+     * @brief S'arrête quand un point d'arrivée est en tête de la frontière,
+     * ou quand tous les coins d'une arrivée flottante sont FROZEN
+     */
+    virtual bool should_continue() const override
+    {
+        if (front->empty()) {
+            return false;
+        }
+        return !goal_reached(front->top().index);
+    }
+
+    /**
+     * @brief Vrai si next (prochaine cellule à développer) est une arrivée,
+     * ou si tous les coins d'une arrivée flottante sont FROZEN
+     */
+    bool goal_reached(long long next) const
+    {
+        // Arrivée flottante : tous les coins sont prêts pour l'interpolation
+        for (const auto& corners : goal_corners) {
+            bool all_frozen = true;
+            for (long long corner : corners) {
+                if (workspace.get_state(corner) != FROZEN) { all_frozen = false; break; }
+            }
+            if (all_frozen) return true;
+        }
+
+        for (long long goal : goal_cells) {
+            if (goal == next) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Boucle spécialisée 2D / 3D : g et h inlinés, coordonnées issues du noyau
+     */
+    virtual bool run_fixed_dimension_loop() override
+    {
+        if (suboptimality_mode == DYNAMIC_WEIGHTING) {
+            run_reopening_loop();
+            return true;
+        }
+        if (suboptimality_mode == FOCAL_SEARCH) {
+            run_focal_loop();
+            return true;
+        }
+
+        const float weight = inflation(0.0f);
+        auto update = [this](const auto&, long long current, long long, const auto&) {
+            return workspace.get_value(current) + edge_cost;
+        };
+        auto priority = [this, weight](const auto& grid, long long neighbor, const auto& coords, float value) {
+            return value + weight * estimate(grid, neighbor, coords);
+        };
+        return run_fixed_dimension(update, priority);
+    }
+
+private:
+    /**
+     * @brief Boucle générique où une cellule FROZEN dont g baisse retourne dans la frontière
+     * (DYNAMIC_WEIGHTING : le poids varie avec g, la ré-ouverture préserve la borne)
+     */
+    void run_reopening_loop()
+    {
+        while (should_continue()) {
+            long long current = front->pop().index;
+            stats.pops++;
+            workspace.set_state(current, FROZEN);
+            stats.expansions++;
+
+            float g = workspace.get_value(current);
+            for_each_neighbor(current, [&](long long neighbor, float step_length) {
+                if (env->is_obstacle(neighbor)) return;
+                float new_value = g + edge_cost * step_length;
+                if (workspace.get_state(neighbor) != FAR && !(new_value < workspace.get_value(neighbor))) return;
+                workspace.set_value(neighbor, new_value);
+                workspace.set_parent(neighbor, current);
+                workspace.set_state(neighbor, FRONT);
+                push_front(neighbor, get_priority(neighbor, new_value));
+            });
+        }
+    }
+
+    /**
+     * @brief Recherche focale (A*-epsilon)
+     *
+     * OPEN est ordonné par f = g + h ; FOCAL contient les cellules de OPEN telles que
+     * f <= w * f_min et en développe celle de plus petit h (la plus proche de l'arrivée
+     * estimée). La cellule de f minimal étant toujours dans FOCAL, la sélection d'une
+     * arrivée garantit g <= w * f_min <= w * optimum. Les deux ensembles sont ordonnés
+     * (std::set) : FOCAL est complété par plage de f quand f_min augmente.
+     */
+    void run_focal_loop()
+    {
+        const float factor = suboptimality_factor;
+        const float unknown = std::numeric_limits<float>::quiet_NaN();
+        std::vector<float> h_values(workspace.size(), unknown);
+        std::vector<std::uint8_t> in_focal(workspace.size(), 0);
+        std::set<std::pair<float, long long>> open;              // (f, cellule)
+        std::set<std::tuple<float, float, long long>> focal;     // (h, f, cellule)
+        float threshold = -std::numeric_limits<float>::infinity(); // w * f_min de la dernière mise à jour de FOCAL
+
+        auto h_of = [&](long long cell) {
+            if (std::isnan(h_values[cell])) h_values[cell] = estimate(dynamic_grid, cell, dynamic_grid.coords(cell));
+            return h_values[cell];
+        };
+        auto insert = [&](long long cell) {
+            float f = workspace.get_value(cell) + h_of(cell);
+            open.insert({f, cell});
+            if (f <= threshold) {
+                focal.insert(std::make_tuple(h_values[cell], f, cell));
+                in_focal[cell] = 1;
+            }
+        };
+        auto remove = [&](long long cell) {
+            float f = workspace.get_value(cell) + h_values[cell];
+            open.erase({f, cell});
+            if (in_focal[cell]) {
+                focal.erase(std::make_tuple(h_values[cell], f, cell));
+                in_focal[cell] = 0;
+            }
+        };
+
+        // Les départs insérés par initialize_starts passent dans OPEN
+        while (!front->empty()) insert(front->pop().index);
+
+        while (!open.empty()) {
+            float bound = factor * open.begin()->first;
+            if (bound < threshold) {
+                // f_min a baissé (heuristique non cohérente) : FOCAL est reconstruit
+                for (const auto& entry : focal) in_focal[std::get<2>(entry)] = 0;
+                focal.clear();
+                threshold = -std::numeric_limits<float>::infinity();
+            }
+            if (bound > threshold) {
+                for (auto it = open.upper_bound({threshold, LLONG_MAX}); it != open.end() && it->first <= bound; ++it) {
+                    if (in_focal[it->second]) continue;
+                    focal.insert(std::make_tuple(h_values[it->second], it->first, it->second));
+                    in_focal[it->second] = 1;
+                }
+                threshold = bound;
+            }
+
+            long long current = std::get<2>(*focal.begin());
+            if (goal_reached(current)) break;
+
+            remove(current);
+            stats.pops++;
+            workspace.set_state(current, FROZEN);
+            stats.expansions++;
+
+            float g = workspace.get_value(current);
+            for_each_neighbor(current, [&](long long neighbor, float step_length) {
+                if (env->is_obstacle(neighbor)) return;
+                float new_value = g + edge_cost * step_length;
+                if (workspace.get_state(neighbor) != FAR && !(new_value < workspace.get_value(neighbor))) return;
+                if (workspace.get_state(neighbor) == FRONT) {
+                    remove(neighbor);
+                    stats.decrease_keys++;
+                } else {
+                    stats.pushes++;
+                }
+                workspace.set_value(neighbor, new_value);
+                workspace.set_parent(neighbor, current);
+                workspace.set_state(neighbor, FRONT);
+                insert(neighbor);
+            });
+        }
+    }
+};
+
+#endif // STATICASTAR_HPP
@@ -0,0 +1,51 @@
+#ifndef EUCLIDEANNEIGHBORS_HPP
+#define EUCLIDEANNEIGHBORS_HPP
+
+#include "NeighborhoodStrategy.hpp"
+
+/**
+ * @brief Voisinage euclidien de rayon r
+ *
+ * Les voisins sont les cellules à une distance euclidienne <= r, avec la longueur exacte
+ * de l'arête comme coût. Par défaut seuls les décalages primitifs (pgcd des composantes = 1)
+ * sont conservés : (2, 0) ou (2, 2) sont redondants avec deux pas (1, 0) ou (1, 1).
+ *
+ * Une arête n'est produite que si aucune des cellules qu'elle traverse n'est un obstacle,
+ * ce qui empêche les grands déplacements de sauter par-dessus un mur fin.
+ *
+ * Exemples en 2D (primitifs):
+ * - r = 1 : 4 voisins, r = √2 : 8 voisins
+ * - r = √5 : 16 voisins (ajoute (±1, ±2), (±2, ±1))
+ * - r = √13 : 32 voisins (ajoute (±1, ±3), (±3, ±1), (±2, ±3), (±3, ±2))
+ *
+ * USAGE: Dijkstra / A* via set_neighborhood(), avec EuclideanHeuristic. Les chemins approchent
+ * la qualité "any-angle" sans lissage, pour un coût par nœud fixé par la taille du stencil.
+ */
+class EuclideanNeighbors : public NeighborhoodStrategy
+{
+private:
+    float max_radius;    ///< Rayon euclidien du voisinage
+    bool primitive_only; ///< Ne garder que les décalages primitifs
+
+public:
+    /**
+     * @param radius Rayon euclidien (>= 1)
+     * @param primitive_only Ignorer les décalages multiples d'un décalage plus court
+     */
+    explicit EuclideanNeighbors(float radius, bool primitive_only = true);
+
+    float get_radius() const { return max_radius; }
+
+    std::string get_name() const override;
+
+protected:
+    void build_stencil(int num_dimensions) override;
+
+private:
+    /**
+     * @brief Ajoute à swept_offsets les cellules dont l'intérieur est traversé par le segment [0, offset]
+     */
+    void add_swept_cells(const std::vector<int>& offset);
+};
+
+#endif // EUCLIDEANNEIGHBORS_HPP
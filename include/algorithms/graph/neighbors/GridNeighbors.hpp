@@ -0,0 +1,49 @@
+#ifndef GRIDNEIGHBORS_HPP
+#define GRIDNEIGHBORS_HPP
+
+#include "NeighborhoodStrategy.hpp"
+
+/**
+ * @brief Voisinage de grille à connectivité configurable
+ *
+ * Les voisins sont les cellules du cube {-1, 0, 1}^N (hors centre) dont au plus
+ * max_moving_axes coordonnées changent. La longueur d'une arête qui modifie k axes
+ * vaut sqrt(k) : 1 (orthogonale), √2 (diagonale de face), √3 (diagonale de cube)...
+ *
+ * Exemples:
+ * - AXIAL : 2N voisins (4 en 2D, 6 en 3D)
+ * - FULL : 3^N - 1 voisins (8 en 2D, 26 en 3D)
+ * - GridNeighbors(2) en 3D : 18 voisins (faces + arêtes)
+ *
+ * USAGE: Dijkstra / A* via set_neighborhood(). Avec FULL en 2D, OctileHeuristic est exacte
+ * sur une carte sans obstacle.
+ */
+class GridNeighbors : public NeighborhoodStrategy
+{
+public:
+    enum Connectivity {
+        AXIAL, ///< 2N voisins orthogonaux
+        FULL   ///< 3^N - 1 voisins (toutes les diagonales)
+    };
+
+private:
+    int max_moving_axes; ///< Nombre maximal d'axes modifiés par un déplacement (0 = tous)
+
+public:
+    explicit GridNeighbors(Connectivity connectivity = FULL);
+
+    /**
+     * @brief Connectivité générale
+     * @param moving_axes Nombre maximal d'axes modifiés simultanément (>= 1)
+     */
+    explicit GridNeighbors(int moving_axes);
+
+    int get_max_moving_axes() const { return max_moving_axes; }
+
+    std::string get_name() const override;
+
+protected:
+    void build_stencil(int num_dimensions) override;
+};
+
+#endif // GRIDNEIGHBORS_HPP
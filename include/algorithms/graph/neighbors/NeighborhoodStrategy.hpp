@@ -0,0 +1,143 @@
+#ifndef NEIGHBORHOODSTRATEGY_HPP
+#define NEIGHBORHOODSTRATEGY_HPP
+
+#include "../../../Environnement.hpp"
+#include <vector>
+#include <string>
+
+/**
+ * @brief Interface pour les voisinages à base de stencil (GridNeighbors, EuclideanNeighbors)
+ *
+ * Un stencil est une liste de décalages entiers avec la longueur de l'arête correspondante.
+ * Les décalages sont convertis une seule fois en décalages d'index linéaire pour des
+ * dimensions de grille (set_environment). Le stencil ne garde que ces dimensions :
+ * obstacles, périodicité et backend sont lus dans l'environnement passé à for_each_neigh.
+ * Une même instance peut donc servir à plusieurs recherches sur des cartes de mêmes
+ * dimensions ; chaque recherche la re-prépare pour sa carte à chaque exécution.
+ * Le partage entre threads n'est pas supporté si les dimensions des cartes diffèrent
+ * (set_environment reconstruit alors le stencil).
+ * Les bords sont gérés par test de coordonnées, avec repli sur les axes périodiques.
+ *
+ * Un stencil peut aussi déclarer, pour chaque entrée, les cellules traversées par l'arête
+ * (swept_offsets) : le voisin n'est alors produit que si aucune d'elles n'est un obstacle.
+ */
+class NeighborhoodStrategy
+{
+protected:
+    std::vector<int> dims;            ///< Dimensions pour lesquelles le stencil est précalculé
+    int dim;                          ///< Nombre de dimensions
+    int radius;                       ///< Plus grand |décalage| sur un axe (zone intérieure sans test de bord)
+
+    std::vector<int> offsets;             ///< Décalages entiers, dim composantes par entrée
+    std::vector<float> costs;             ///< Longueur de chaque arête du stencil
+    std::vector<long long> strides;       ///< Strides row-major de l'environnement
+    std::vector<long long> linear_offsets; ///< Décalage d'index linéaire de chaque entrée
+
+    std::vector<int> swept_offsets;        ///< Cellules traversées, dim composantes par cellule (optionnel)
+    std::vector<int> swept_begin;          ///< Entrée k : cellules [swept_begin[k], swept_begin[k+1]) (vide = aucun test)
+    std::vector<long long> swept_linear;   ///< Décalage d'index linéaire de chaque cellule traversée
+
+public:
+    NeighborhoodStrategy();
+    virtual ~NeighborhoodStrategy() = default;
+
+    /**
+     * @brief Précalcule le stencil pour les dimensions de l'environnement (ne fait rien si elles sont inchangées)
+     */
+    void set_environment(const Environnement* env);
+
+    /**
+     * @brief Nombre d'entrées du stencil (borne sur le nombre de voisins d'une cellule)
+     */
+    int get_max_neighbors() const { return static_cast<int>(costs.size()); }
+
+    /**
+     * @brief Plus petite longueur d'arête du stencil (1 pour les stencils usuels)
+     */
+    float get_min_cost() const;
+
+    /**
+     * @brief Vrai si des arêtes du stencil dépendent de cellules traversées (voir swept_offsets)
+     */
+    bool has_swept_cells() const { return !swept_offsets.empty(); }
+
+    /**
+     * @brief Appelle func(index_voisin, longueur_arête) pour chaque voisin dans la grille, sans allocation
+     * Les obstacles ne sont pas filtrés ici (c'est le rôle de l'algorithme de recherche),
+     * sauf les cellules traversées d'un stencil qui en déclare.
+     * @param env Environnement de la requête, de mêmes dimensions que celles du stencil
+     */
+    template <typename Func>
+    void for_each_neigh(const Environnement& env, long long index, Func&& func) const
+    {
+        const GridShape& shape = env.get_shape();
+        const bool check_existence = env.get_backend() == Environnement::MAP; // Backend MAP : les cellules peuvent manquer
+        int coords[Environnement::MAX_DIMS];
+        bool interior = true;
+        for (int i = 0; i < dim; i++) {
+            coords[i] = shape.coord(index, i);
+            if (coords[i] < radius || coords[i] >= dims[i] - radius) interior = false;
+        }
+
+        const size_t count = costs.size();
+        const bool sweep = !swept_begin.empty();
+        if (interior && !check_existence) {
+            // Cas courant : tous les voisins sont dans la grille, simples décalages d'index
+            for (size_t k = 0; k < count; k++) {
+                if (sweep && !is_sweep_free_interior(env, index, k)) continue;
+                func(index + linear_offsets[k], costs[k]);
+            }
+            return;
+        }
+
+        bool periodic[Environnement::MAX_DIMS];
+        for (int i = 0; i < dim; i++) periodic[i] = env.is_periodic(i);
+        for (size_t k = 0; k < count; k++) {
+            long long neighbor = 0;
+            bool valid = true;
+            for (int i = 0; i < dim; i++) {
+                int c = coords[i] + offsets[k * dim + i];
+                if (c < 0 || c >= dims[i]) {
+                    if (!periodic[i]) { valid = false; break; }
+                    c = ((c % dims[i]) + dims[i]) % dims[i];
+                }
+                neighbor += c * strides[i];
+            }
+            if (!valid || neighbor == index) continue;
+            if (check_existence && !env.has_index(neighbor)) continue;
+            if (sweep && !is_sweep_free(env, coords, periodic, k)) continue;
+            func(neighbor, costs[k]);
+        }
+    }
+
+    /**
+     * @brief Nom du voisinage (pour debug/logs)
+     */
+    virtual std::string get_name() const = 0;
+
+protected:
+    /**
+     * @brief Remplit offsets et costs pour un nombre de dimensions donné
+     * @param num_dimensions Nombre de dimensions de l'environnement
+     */
+    virtual void build_stencil(int num_dimensions) = 0;
+
+private:
+    /**
+     * @brief Vrai si aucune cellule traversée par l'entrée k n'est un obstacle (cellule intérieure)
+     */
+    bool is_sweep_free_interior(const Environnement& env, long long index, size_t k) const
+    {
+        for (int s = swept_begin[k]; s < swept_begin[k + 1]; s++) {
+            if (env.is_obstacle(index + swept_linear[s])) return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Vrai si les cellules traversées par l'entrée k existent et sont libres (cas général)
+     */
+    bool is_sweep_free(const Environnement& env, const int* coords, const bool* periodic, size_t k) const;
+};
+
+#endif // NEIGHBORHOODSTRATEGY_HPP
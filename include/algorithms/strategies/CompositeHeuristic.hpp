@@ -5,6 +5,7 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <cmath>
 
 /**
  * @brief Heuristique composite combinant plusieurs heuristiques
@@ -33,36 +34,33 @@ public:
         weights.push_back(weight);
     }
     
-    float calculate_heuristic(const Point* from, const std::vector<float>& goal) const override {
+    float calculate_heuristic(const Cell& from, const std::vector<float>& goal) const override {
         if (heuristics.empty()) return 0.0f;
         
-        std::vector<float> values;
-        for (const auto& h : heuristics) {
-            values.push_back(h->calculate_heuristic(from, goal));
+        // Combinaison au fil de l'eau (aucune allocation par appel)
+        float combined = mode == MIN ? INFINITY : 0.0f;
+        float weight_sum = 0.0f;
+        for (size_t i = 0; i < heuristics.size(); ++i) {
+            float value = heuristics[i]->calculate_heuristic(from, goal);
+            switch (mode) {
+                case MAX: combined = i == 0 ? value : std::max(combined, value); break;
+                case MIN: combined = std::min(combined, value); break;
+                case AVERAGE: combined += value; break;
+                case WEIGHTED:
+                    combined += value * weights[i];
+                    weight_sum += weights[i];
+                    break;
+            }
         }
         
         switch (mode) {
             case MAX:
-                return *std::max_element(values.begin(), values.end());
-                
             case MIN:
-                return *std::min_element(values.begin(), values.end());
-                
-            case AVERAGE: {
-                float sum = 0.0f;
-                for (float v : values) sum += v;
-                return sum / values.size();
-            }
-            
-            case WEIGHTED: {
-                float weighted_sum = 0.0f;
-                float weight_sum = 0.0f;
-                for (size_t i = 0; i < values.size(); ++i) {
-                    weighted_sum += values[i] * weights[i];
-                    weight_sum += weights[i];
-                }
-                return weight_sum > 0 ? weighted_sum / weight_sum : 0.0f;
-            }
+                return combined;
+            case AVERAGE:
+                return combined / heuristics.size();
+            case WEIGHTED:
+                return weight_sum > 0 ? combined / weight_sum : 0.0f;
         }
         return 0.0f;
     }
@@ -21,13 +21,11 @@ public:
     DiagonalHeuristic(float diag_cost = 1.0f, float ortho_cost = 1.0f) 
         : diagonal_cost(diag_cost), orthogonal_cost(ortho_cost) {}
     
-    float calculate_heuristic(const Point* from, const std::vector<float>& goal) const override {
-        auto coords = from->get_coords();
-        
+    float calculate_heuristic(const Cell& from, const std::vector<float>& goal) const override {
         float res = 0;
-        for (size_t i = 0 ; i<coords.size() ; i++)
+        for (int i = 0 ; i<from.get_dim() ; i++)
         {
-            res = std::max(res,std::abs(coords[i] - goal[i]));
+            res = std::max(res,std::abs(from.coord(i) - goal[i]));
         }
         
         // Chebyshev: maximum des deux distances
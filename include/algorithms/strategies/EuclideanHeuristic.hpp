@@ -27,17 +27,15 @@ public:
         }
     }
     
-    float calculate_heuristic(const Point* from, const std::vector<float>& goal) const override {
-        auto coords = from->get_coords();
-        
+    float calculate_heuristic(const Cell& from, const std::vector<float>& goal) const override {
         if (environment) {
             // Utiliser la méthode de l'environnement (gère automatiquement la périodicité)
-            return weight_factor * environment->calculate_distance(coords, goal, 2);
+            return weight_factor * environment->calculate_distance(from, goal, 2);
         } else {
             // Fallback vers calcul classique
             float sum = 0;
-            for (size_t i = 0; i < coords.size(); ++i) {
-                float diff = coords[i] - goal[i];
+            for (int i = 0; i < from.get_dim(); ++i) {
+                float diff = from.coord(i) - goal[i];
                 sum += diff * diff;
             }
             return weight_factor * std::sqrt(sum);
@@ -1,7 +1,7 @@
 #ifndef HEURISTICSTRATEGY_HPP
 #define HEURISTICSTRATEGY_HPP
 
-#include "../../Point.hpp"
+#include "../../Cell.hpp"
 #include <vector>
 #include <string>
 #include <stdexcept>
@@ -30,11 +30,11 @@ public:
     
     /**
      * @brief Calcule l'heuristique h(n) = distance estimée vers le goal
-     * @param from Point de départ
+     * @param from Cellule de départ (coordonnées calculées à la demande)
      * @param goal Coordonnées du goal
      * @return Distance estimée (doit être admissible)
      */
-    virtual float calculate_heuristic(const Point* from, const std::vector<float>& goal) const = 0;
+    virtual float calculate_heuristic(const Cell& from, const std::vector<float>& goal) const = 0;
     
     /**
      * @brief Nom de l'heuristique (pour debug/logs)
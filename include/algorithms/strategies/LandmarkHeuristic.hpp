@@ -0,0 +1,137 @@
+#ifndef LANDMARKHEURISTIC_HPP
+#define LANDMARKHEURISTIC_HPP
+
+#include "HeuristicStrategy.hpp"
+#include <vector>
+#include <string>
+
+class GraphSearchBase;
+
+/**
+ * @brief Heuristique ALT (A*, Landmarks, inégalité Triangulaire)
+ *
+ * K points de repère sont choisis puis une recherche (Dijkstra par défaut, ou toute
+ * GraphSearchBase configurée par l'appelant : voisinage, FMM...) est lancée depuis chacun
+ * pour stocker la distance de chaque cellule au repère. À la requête :
+ *     h(n) = max_L |d(L, goal) - d(L, n)|
+ * borne inférieure qui tient compte des obstacles (labyrinthes, entrepôts), cohérente
+ * si les tables viennent de la même métrique que la recherche A*. Pour une arrivée flottante,
+ * la borne de chaque coin est pondérée par son poids d'interpolation, comme la valeur
+ * interpolée du champ : h(n) = Σ_coin w_coin · max_L |d(L, coin) - d(L, n)|.
+ *
+ * Sélection des repères :
+ * - FARTHEST : chaque repère maximise la distance au plus proche des repères déjà choisis
+ * - AVOID : méthode « avoid » de Goldberg & Werneck, repère placé dans la zone où
+ *   la borne actuelle est la plus mauvaise
+ *
+ * Les tables se sauvegardent et se rechargent (save / load) : le fichier mémorise la forme
+ * de la grille et une empreinte des obstacles, un fichier d'une autre carte est refusé.
+ *
+ * Exemple:
+ *     LandmarkHeuristic alt(8);
+ *     alt.preprocess(&env);
+ *     AStar astar(&env, 1.0f, &alt);
+ */
+class LandmarkHeuristic : public HeuristicStrategy
+{
+public:
+    enum Selection {
+        FARTHEST,   ///< Points les plus éloignés (farthest-point)
+        AVOID       ///< Méthode avoid (Goldberg & Werneck)
+    };
+
+private:
+    int landmark_count;
+    Selection selection;
+    unsigned int seed;
+    long long cell_count;
+    std::vector<long long> landmarks;  ///< Index des repères
+    std::vector<float> distances;      ///< distances[l * cell_count + index] = d(repère l, index)
+
+    // Cache de la dernière arrivée : distances des repères aux coins de l'arrivée
+    mutable std::vector<float> cached_goal;
+    mutable std::vector<float> goal_distances;  ///< [coin * K + l]
+    mutable std::vector<float> goal_weights;    ///< Poids d'interpolation de chaque coin libre (1 pour une arrivée entière)
+
+public:
+    /**
+     * @brief Constructeur
+     * @param count Nombre de repères K
+     * @param method Méthode de sélection des repères
+     * @param random_seed Graine du premier repère
+     */
+    explicit LandmarkHeuristic(int count = 8, Selection method = FARTHEST, unsigned int random_seed = 0);
+
+    /**
+     * @brief Choisit les repères et calcule leurs tables de distances
+     * @param env Environnement (devient l'environnement de l'heuristique)
+     * @param search Recherche utilisée pour les tables (nullptr : Dijkstra à voisins axiaux)
+     */
+    void preprocess(Environnement* env, GraphSearchBase* search = nullptr);
+
+    /**
+     * @brief Sauvegarde repères et tables (binaire)
+     */
+    void save(const std::string& filename) const;
+
+    /**
+     * @brief Recharge des tables calculées sur cet environnement
+     * @throws std::runtime_error si le fichier est illisible, corrompu (nombre de repères
+     * hors de ]0, nombre de cellules], repère hors de la grille ou sur un obstacle)
+     * ou correspond à une autre carte
+     */
+    void load(const std::string& filename, const Environnement* env);
+
+    bool is_ready() const { return !landmarks.empty(); }
+    const std::vector<long long>& get_landmarks() const { return landmarks; }
+
+    /**
+     * @brief Distance de la cellule index au repère l (INFINITY si non atteinte)
+     */
+    float get_distance(int landmark, long long index) const { return distances[landmark * cell_count + index]; }
+
+    /**
+     * @brief Borne ALT pour une cellule (index linéaire) vers une arrivée entière ou flottante
+     */
+    float estimate(long long index, const std::vector<float>& goal) const;
+
+    float calculate_heuristic(const Cell& from, const std::vector<float>& goal) const override {
+        return estimate(from.get_index(), goal);
+    }
+
+    std::string get_name() const override;
+
+    bool is_admissible() const override { return true; }
+
+    std::string get_description() const override {
+        return "Bornes d'inégalité triangulaire sur des distances précalculées depuis K repères. "
+               "Tient compte des obstacles.";
+    }
+
+private:
+    void compute_table(GraphSearchBase& search, long long landmark);
+    long long choose_root(GraphSearchBase& search, unsigned int round,
+                          std::vector<float>& root_distances, std::vector<long long>& parents) const;
+    long long farthest_from(const std::vector<float>& root_distances) const;
+    long long select_farthest() const;
+    long long select_avoid(long long root, const std::vector<float>& root_distances,
+                           const std::vector<long long>& parents) const;
+    float lower_bound(long long from, long long to) const;
+    void prepare_goal(const std::vector<float>& goal) const;
+};
+
+/**
+ * @brief Adaptateur statique (StaticAStar / BidirectionalAStar) autour d'une LandmarkHeuristic
+ */
+struct LandmarkDistance
+{
+    const LandmarkHeuristic* landmarks = nullptr;
+
+    template <typename Grid, typename Coords>
+    float operator()(const Grid&, long long index, const Coords&, const std::vector<float>& goal) const
+    {
+        return landmarks ? landmarks->estimate(index, goal) : 0.0f;
+    }
+};
+
+#endif // LANDMARKHEURISTIC_HPP
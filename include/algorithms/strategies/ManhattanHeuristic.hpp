@@ -25,17 +25,15 @@ public:
         }
     }
     
-    float calculate_heuristic(const Point* from, const std::vector<float>& goal) const override {
-        auto coords = from->get_coords();
-        
+    float calculate_heuristic(const Cell& from, const std::vector<float>& goal) const override {
         if (environment) {
             // Utiliser la méthode de l'environnement (gère automatiquement la périodicité)
-            return weight_factor * environment->calculate_distance(coords, goal, 1);
+            return weight_factor * environment->calculate_distance(from, goal, 1);
         } else {
             // Fallback vers calcul classique
             float sum = 0;
-            for (size_t i = 0; i < coords.size(); ++i) {
-                sum += std::abs(coords[i] - goal[i]);
+            for (int i = 0; i < from.get_dim(); ++i) {
+                sum += std::abs(from.coord(i) - goal[i]);
             }
             return weight_factor * sum;
         }
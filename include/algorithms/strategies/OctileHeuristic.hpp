@@ -4,6 +4,7 @@
 #include "HeuristicStrategy.hpp"
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 /**
  * @brief Heuristique Octile (optimale pour grilles 8-connectées)
@@ -22,21 +23,18 @@ public:
     OctileHeuristic(float diag_cost = std::sqrt(2.0f), float ortho_cost = 1.0f) 
         : diagonal_cost(diag_cost), orthogonal_cost(ortho_cost) {}
     
-    float calculate_heuristic(const Point* from, const std::vector<float>& goal) const override {
-        auto coords = from->get_coords();
-        
-        float sum_abs_diff = 0.0f;
+    float calculate_heuristic(const Cell& from, const std::vector<float>& goal) const override {
+        float min_abs_diff = std::numeric_limits<float>::infinity();
         float max_abs_diff = 0.0f;
 
-        // Calculate the sum of absolute differences and the maximum absolute difference
-        for (size_t i = 0; i < coords.size(); ++i) {
-            float diff = std::abs(coords[i] - goal[i]);
-            sum_abs_diff += diff;
-            if (diff > max_abs_diff) {
-                max_abs_diff = diff;
-            }
+        // Diagonales sur le plus petit écart, déplacements orthogonaux sur le reste
+        for (int i = 0; i < from.get_dim(); ++i) {
+            float diff = std::abs(from.coord(i) - goal[i]);
+            min_abs_diff = std::min(min_abs_diff, diff);
+            max_abs_diff = std::max(max_abs_diff, diff);
         }
-        return diagonal_cost * max_abs_diff + orthogonal_cost * (sum_abs_diff - max_abs_diff);
+        if (from.get_dim() < 2) min_abs_diff = 0.0f;
+        return diagonal_cost * min_abs_diff + orthogonal_cost * (max_abs_diff - min_abs_diff);
     }
     
     std::string get_name() const override { 
@@ -0,0 +1,188 @@
+#ifndef STATICHEURISTICS_HPP
+#define STATICHEURISTICS_HPP
+
+#include "HeuristicStrategy.hpp"
+#include "../../FixedGrid.hpp"
+#include <vector>
+#include <tuple>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+/**
+ * @brief Heuristiques à dispatch statique pour StaticAStar<Heuristic>
+ *
+ * Chaque heuristique est un foncteur appelé sous la forme
+ *     h(grid, index, from, goal)
+ * où grid est une FixedGrid<N> (boucles déroulées) ou une DynamicGrid, from les coordonnées
+ * entières de la cellule d'index donné et goal les coordonnées du but. Les écarts par axe
+ * passent par grid.axis_distance, qui gère les axes périodiques.
+ *
+ * Les combinaisons (MaxOf, MinOf, AverageOf) sont des replis à la compilation : aucune
+ * allocation ni appel virtuel. StrategyHeuristic adapte un HeuristicStrategy existant.
+ */
+
+/**
+ * @brief h = 0 (A* se comporte comme Dijkstra)
+ */
+struct ZeroDistance
+{
+    template <typename Grid, typename Coords>
+    float operator()(const Grid&, long long, const Coords&, const std::vector<float>&) const { return 0.0f; }
+};
+
+/**
+ * @brief Distance euclidienne pondérée (équivalent statique de EuclideanHeuristic)
+ */
+struct EuclideanDistance
+{
+    float weight = 1.0f;
+
+    template <typename Grid, typename Coords>
+    float operator()(const Grid& grid, long long, const Coords& from, const std::vector<float>& goal) const
+    {
+        float sum = 0.0f;
+        for (int i = 0; i < grid.dim(); i++) {
+            float diff = grid.axis_distance(i, from[i], goal[i]);
+            sum += diff * diff;
+        }
+        return weight * std::sqrt(sum);
+    }
+};
+
+/**
+ * @brief Distance de Manhattan pondérée (équivalent statique de ManhattanHeuristic)
+ */
+struct ManhattanDistance
+{
+    float weight = 1.0f;
+
+    template <typename Grid, typename Coords>
+    float operator()(const Grid& grid, long long, const Coords& from, const std::vector<float>& goal) const
+    {
+        float sum = 0.0f;
+        for (int i = 0; i < grid.dim(); i++) sum += grid.axis_distance(i, from[i], goal[i]);
+        return weight * sum;
+    }
+};
+
+/**
+ * @brief Distance de Chebyshev (équivalent statique de DiagonalHeuristic)
+ */
+struct ChebyshevDistance
+{
+    float diagonal_cost = 1.0f;
+
+    template <typename Grid, typename Coords>
+    float operator()(const Grid& grid, long long, const Coords& from, const std::vector<float>& goal) const
+    {
+        float result = 0.0f;
+        for (int i = 0; i < grid.dim(); i++) result = std::max(result, grid.axis_distance(i, from[i], goal[i]));
+        return result * diagonal_cost;
+    }
+};
+
+/**
+ * @brief Distance octile (équivalent statique de OctileHeuristic)
+ */
+struct OctileDistance
+{
+    float diagonal_cost = std::sqrt(2.0f);
+    float orthogonal_cost = 1.0f;
+
+    template <typename Grid, typename Coords>
+    float operator()(const Grid& grid, long long, const Coords& from, const std::vector<float>& goal) const
+    {
+        float min_abs_diff = std::numeric_limits<float>::infinity();
+        float max_abs_diff = 0.0f;
+        for (int i = 0; i < grid.dim(); i++) {
+            float diff = grid.axis_distance(i, from[i], goal[i]);
+            min_abs_diff = std::min(min_abs_diff, diff);
+            max_abs_diff = std::max(max_abs_diff, diff);
+        }
+        if (grid.dim() < 2) min_abs_diff = 0.0f;
+        return diagonal_cost * min_abs_diff + orthogonal_cost * (max_abs_diff - min_abs_diff);
+    }
+};
+
+/**
+ * @brief Maximum de plusieurs heuristiques (admissible si chacune l'est)
+ */
+template <typename... Heuristics>
+struct MaxOf
+{
+    std::tuple<Heuristics...> parts;
+
+    MaxOf() = default;
+    explicit MaxOf(Heuristics... heuristics) : parts(heuristics...) {}
+
+    template <typename Grid, typename Coords>
+    float operator()(const Grid& grid, long long index, const Coords& from, const std::vector<float>& goal) const
+    {
+        return std::apply([&](const auto&... h) {
+            float result = 0.0f;
+            ((result = std::max(result, h(grid, index, from, goal))), ...);
+            return result;
+        }, parts);
+    }
+};
+
+/**
+ * @brief Minimum de plusieurs heuristiques
+ */
+template <typename... Heuristics>
+struct MinOf
+{
+    std::tuple<Heuristics...> parts;
+
+    MinOf() = default;
+    explicit MinOf(Heuristics... heuristics) : parts(heuristics...) {}
+
+    template <typename Grid, typename Coords>
+    float operator()(const Grid& grid, long long index, const Coords& from, const std::vector<float>& goal) const
+    {
+        return std::apply([&](const auto&... h) {
+            float result = INFINITY;
+            ((result = std::min(result, h(grid, index, from, goal))), ...);
+            return result;
+        }, parts);
+    }
+};
+
+/**
+ * @brief Moyenne de plusieurs heuristiques
+ */
+template <typename... Heuristics>
+struct AverageOf
+{
+    std::tuple<Heuristics...> parts;
+
+    AverageOf() = default;
+    explicit AverageOf(Heuristics... heuristics) : parts(heuristics...) {}
+
+    template <typename Grid, typename Coords>
+    float operator()(const Grid& grid, long long index, const Coords& from, const std::vector<float>& goal) const
+    {
+        return std::apply([&](const auto&... h) {
+            return (0.0f + ... + h(grid, index, from, goal)) / static_cast<float>(sizeof...(Heuristics));
+        }, parts);
+    }
+};
+
+/**
+ * @brief Adaptateur vers l'interface virtuelle HeuristicStrategy (sans stratégie : h = 0)
+ */
+struct StrategyHeuristic
+{
+    const HeuristicStrategy* strategy = nullptr;
+    const Environnement* environment = nullptr;
+
+    template <typename Grid, typename Coords>
+    float operator()(const Grid&, long long index, const Coords&, const std::vector<float>& goal) const
+    {
+        if (!strategy) return 0.0f;
+        return strategy->calculate_heuristic(environment->cell(index), goal);
+    }
+};
+
+#endif // STATICHEURISTICS_HPP
@@ -0,0 +1,60 @@
+#ifndef BINARYIO_HPP
+#define BINARYIO_HPP
+
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Lecture / écriture binaire brute des précalculs sauvegardés (même machine, même endianness)
+ */
+namespace BinaryIO
+{
+
+template <typename T>
+void write_value(std::ofstream& file, const T& value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void write_vector(std::ofstream& file, const std::vector<T>& values)
+{
+    file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+/**
+ * @throws std::runtime_error si le fichier est tronqué
+ */
+template <typename T>
+T read_value(std::ifstream& file)
+{
+    T value{};
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!file) throw std::runtime_error("BinaryIO: truncated file.");
+    return value;
+}
+
+/**
+ * @brief Lit count éléments (vérifie la taille restante avant d'allouer)
+ * @throws std::runtime_error si le fichier est tronqué
+ */
+template <typename T>
+std::vector<T> read_vector(std::ifstream& file, size_t count)
+{
+    std::streampos position = file.tellg();
+    file.seekg(0, std::ios::end);
+    std::streampos end = file.tellg();
+    file.seekg(position);
+    if (!file || position < 0 || count > static_cast<size_t>(end - position) / sizeof(T)) {
+        throw std::runtime_error("BinaryIO: truncated file.");
+    }
+    std::vector<T> values(count);
+    file.read(reinterpret_cast<char*>(values.data()), count * sizeof(T));
+    if (!file) throw std::runtime_error("BinaryIO: truncated file.");
+    return values;
+}
+
+}
+
+#endif // BINARYIO_HPP
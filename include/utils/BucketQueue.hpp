@@ -0,0 +1,75 @@
+#ifndef BUCKETQUEUE_HPP
+#define BUCKETQUEUE_HPP
+
+#include "FrontQueue.hpp"
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief File à seaux circulaire (Dial / "untidy" queue)
+ *
+ * Une clé k tombe dans le seau floor(k / largeur). Les seaux forment un anneau
+ * parcouru par un curseur qui ne recule jamais : insertion, decrease-key et
+ * extraction sont en O(1) amorti. L'anneau double de taille si une clé dépasse
+ * la fenêtre couverte. Les clés inférieures au curseur sont rangées dans le seau
+ * courant (cas non monotone).
+ *
+ * Dans un seau, les cellules ne sont pas triées :
+ * - LIFO (Dial) : exact pour Dijkstra si la largeur <= plus petit coût d'arête
+ * - FIFO (untidy) : ordre d'arrivée, utilisé par le FMM en O(N) (erreur O(largeur))
+ */
+class BucketQueue : public FrontQueue
+{
+public:
+    static constexpr std::uint32_t NOT_IN_QUEUE = std::numeric_limits<std::uint32_t>::max();
+
+private:
+    struct Bucket {
+        std::vector<FrontEntry> items; ///< Entrées, index = -1 pour une entrée retirée
+        std::uint32_t head = 0;        ///< Première entrée potentiellement vivante
+        std::uint32_t live = 0;        ///< Nombre d'entrées vivantes
+    };
+
+    float width;                       ///< Largeur d'un seau
+    bool fifo;                         ///< Ordre d'extraction dans un seau
+    std::vector<Bucket> ring;          ///< Anneau de seaux (taille puissance de 2)
+    long long cursor;                  ///< Numéro absolu du seau courant (le plus petit non vide)
+    size_t count;                      ///< Nombre d'entrées vivantes
+    std::vector<std::uint32_t> bucket_of; ///< Seau (indice dans l'anneau) de chaque cellule
+    std::vector<std::uint32_t> slot_of;   ///< Position de chaque cellule dans son seau
+
+public:
+    /**
+     * @param bucket_width Largeur d'un seau (> 0)
+     * @param fifo_order true : FIFO dans un seau (untidy), false : LIFO (Dial)
+     */
+    explicit BucketQueue(float bucket_width, bool fifo_order = false);
+
+    void resize(long long cell_count) override;
+    void clear() override;
+
+    bool empty() const override { return count == 0; }
+    size_t size() const override { return count; }
+    long long capacity() const override { return static_cast<long long>(bucket_of.size()); }
+    bool contains(long long index) const override { return bucket_of[index] != NOT_IN_QUEUE; }
+
+    FrontEntry top() const override;
+    FrontEntry pop() override;
+    bool push(long long index, float key) override;
+    void erase(long long index) override;
+
+    float get_width() const { return width; }
+
+    std::string get_name() const override;
+
+private:
+    long long bucket_number(float key) const;
+    void insert(long long index, float key);
+    void remove(long long index);
+    void grow(long long required);
+    const FrontEntry& next_in(const Bucket& bucket) const;
+    void advance_cursor();
+};
+
+#endif // BUCKETQUEUE_HPP
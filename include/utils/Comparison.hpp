@@ -11,4 +11,21 @@ struct Compare
     }
 };
 
+/**
+ * @brief Entrée de la frontière : valeur de priorité et index linéaire de la cellule
+ */
+struct FrontEntry
+{
+    float value;
+    long long index;
+};
+
+struct CompareEntry
+{
+    bool operator()(const FrontEntry& e1, const FrontEntry& e2) const
+    {
+        return e1.value > e2.value;
+    }
+};
+
 #endif // COMPARISON_HPP
\ No newline at end of file
@@ -0,0 +1,79 @@
+#ifndef FRONTQUEUE_HPP
+#define FRONTQUEUE_HPP
+
+#include "Comparison.hpp"
+#include <memory>
+#include <string>
+
+/**
+ * @brief Structure de données utilisée pour la frontière d'une recherche
+ */
+enum QueuePolicy {
+    DARY_HEAP,     ///< Tas 4-aire indexé (exact, tout type de clé)
+    DIAL_BUCKETS,  ///< Seaux de Dial (exact si la largeur d'un seau <= plus petit incrément de clé)
+    RADIX_HEAP,    ///< Tas radix monotone (exact si les clés insérées ne décroissent pas)
+    UNTIDY_BUCKETS ///< Seaux non triés, FIFO dans un seau (FMM "untidy" en O(N), erreur O(largeur))
+};
+
+/**
+ * @brief Interface de la frontière indexée par cellule
+ *
+ * Une cellule figure au plus une fois dans la file : push() sur une cellule déjà
+ * présente modifie sa clé. Toutes les implémentations sont dimensionnées une fois
+ * pour la grille (resize) puis vidées en O(taille de la file) entre deux requêtes.
+ */
+class FrontQueue
+{
+public:
+    virtual ~FrontQueue() = default;
+
+    /**
+     * @brief Crée la file correspondant à une politique
+     * @param policy Structure de données choisie
+     * @param bucket_width Largeur d'un seau (DIAL_BUCKETS / UNTIDY_BUCKETS uniquement, > 0)
+     */
+    static std::unique_ptr<FrontQueue> create(QueuePolicy policy, float bucket_width = 1.0f);
+
+    /**
+     * @brief Dimensionne les tables indexées par cellule et vide la file
+     */
+    virtual void resize(long long cell_count) = 0;
+
+    /**
+     * @brief Vide la file sans réallouer
+     */
+    virtual void clear() = 0;
+
+    virtual bool empty() const = 0;
+    virtual size_t size() const = 0;
+    virtual long long capacity() const = 0;
+    virtual bool contains(long long index) const = 0;
+
+    /**
+     * @brief Prochaine entrée extraite (la file ne doit pas être vide)
+     */
+    virtual FrontEntry top() const = 0;
+
+    /**
+     * @brief Retire et renvoie la prochaine entrée
+     */
+    virtual FrontEntry pop() = 0;
+
+    /**
+     * @brief Insère une cellule ou modifie sa clé si elle est déjà présente
+     * @return true si la cellule a été insérée, false si sa clé a été modifiée
+     */
+    virtual bool push(long long index, float key) = 0;
+
+    /**
+     * @brief Retire une cellule (sans effet si elle est absente)
+     */
+    virtual void erase(long long index) = 0;
+
+    /**
+     * @brief Nom de la structure (pour debug/logs)
+     */
+    virtual std::string get_name() const = 0;
+};
+
+#endif // FRONTQUEUE_HPP
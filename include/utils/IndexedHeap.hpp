@@ -0,0 +1,81 @@
+#ifndef INDEXEDHEAP_HPP
+#define INDEXEDHEAP_HPP
+
+#include "FrontQueue.hpp"
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Tas d-aire indexé (min-heap) sur les index linéaires de cellules
+ *
+ * Chaque cellule apparaît au plus une fois : une table de positions (une entrée
+ * par cellule) permet de modifier la clé d'une cellule déjà présente (decrease-key)
+ * au lieu d'empiler un doublon. L'arité 4 réduit la hauteur du tas et garde les
+ * enfants d'un nœud dans la même ligne de cache.
+ */
+class IndexedHeap : public FrontQueue
+{
+public:
+    static constexpr int ARITY = 4;
+    static constexpr std::uint32_t NOT_IN_HEAP = std::numeric_limits<std::uint32_t>::max();
+
+private:
+    std::vector<FrontEntry> heap;        ///< Entrées (clé, index) rangées en tas
+    std::vector<std::uint32_t> position; ///< Position de chaque cellule dans heap, NOT_IN_HEAP si absente
+
+public:
+    IndexedHeap() = default;
+
+    /**
+     * @brief Dimensionne la table des positions et vide le tas
+     * @param cell_count Nombre total de cellules de la grille
+     */
+    void resize(long long cell_count) override;
+
+    /**
+     * @brief Vide le tas en O(taille du tas), sans parcourir toute la table des positions
+     */
+    void clear() override;
+
+    bool empty() const override { return heap.empty(); }
+    size_t size() const override { return heap.size(); }
+    long long capacity() const override { return static_cast<long long>(position.size()); }
+
+    bool contains(long long index) const override { return position[index] != NOT_IN_HEAP; }
+
+    /**
+     * @brief Clé courante d'une cellule présente dans le tas
+     */
+    float get_key(long long index) const { return heap[position[index]].value; }
+
+    /**
+     * @brief Entrée de plus petite clé (le tas ne doit pas être vide)
+     */
+    FrontEntry top() const override { return heap.front(); }
+
+    /**
+     * @brief Retire et renvoie l'entrée de plus petite clé
+     */
+    FrontEntry pop() override;
+
+    /**
+     * @brief Insère une cellule ou modifie sa clé si elle est déjà présente
+     * @return true si la cellule a été insérée, false si sa clé a été modifiée
+     */
+    bool push(long long index, float key) override;
+
+    /**
+     * @brief Retire une cellule du tas (sans effet si elle est absente)
+     */
+    void erase(long long index) override;
+
+    std::string get_name() const override { return "DaryHeap(4)"; }
+
+private:
+    void sift_up(size_t pos);
+    void sift_down(size_t pos);
+    void place(size_t pos, const FrontEntry& entry);
+};
+
+#endif // INDEXEDHEAP_HPP
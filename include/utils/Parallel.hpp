@@ -0,0 +1,32 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Nombre de threads effectif
+ * @param requested Nombre demandé (0 = std::thread::hardware_concurrency)
+ * @param useful Nombre maximal de threads utiles
+ */
+inline int resolve_thread_count(int requested, int useful)
+{
+    int threads = requested > 0 ? requested : static_cast<int>(std::thread::hardware_concurrency());
+    return std::max(1, std::min(threads, useful));
+}
+
+/**
+ * @brief Exécute func(0) ... func(count - 1) sur count threads (func(0) sur le thread appelant)
+ */
+template <typename Func>
+void run_threads(int count, Func&& func)
+{
+    std::vector<std::thread> workers;
+    workers.reserve(count > 1 ? count - 1 : 0);
+    for (int t = 1; t < count; t++) workers.emplace_back(func, t);
+    func(0);
+    for (auto& worker : workers) worker.join();
+}
+
+#endif // PARALLEL_HPP
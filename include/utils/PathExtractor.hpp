@@ -2,6 +2,7 @@
 #define PATHEXTRACTOR_HPP
 
 #include "../Point.hpp"
+#include "../algorithms/graph/SearchWorkspace.hpp"
 #include <vector>
 
 class PathExtractor
@@ -9,6 +10,9 @@ class PathExtractor
 public:
     // Futur: Extraction de chemins depuis les parents
     static std::vector<Point*> extractPath(Point* goal);
+
+    // Extraction depuis les parents d'un SearchWorkspace (indices linéaires, départ en tête)
+    static std::vector<long long> extractPath(const SearchWorkspace& workspace, long long goal);
     
     // Futur: Validation de chemin
     static bool isValidPath(const std::vector<Point*>& path);
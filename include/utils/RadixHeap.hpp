@@ -0,0 +1,65 @@
+#ifndef RADIXHEAP_HPP
+#define RADIXHEAP_HPP
+
+#include "FrontQueue.hpp"
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Tas radix monotone sur des clés flottantes positives
+ *
+ * Les clés sont comparées via leur représentation binaire IEEE 754 (croissante pour
+ * les flottants >= 0). Le seau i contient les clés dont le bit de poids fort qui
+ * diffère de la dernière clé extraite est le bit i - 1 ; le seau 0 contient les clés
+ * égales à la dernière clé extraite. Chaque entrée ne descend que vers des seaux
+ * plus petits : O(log C) amorti par entrée, sans comparaison entre clés.
+ *
+ * Exact tant que les clés insérées ne sont pas inférieures à la dernière clé
+ * extraite (Dijkstra, FMM). Une clé plus petite est rangée dans le seau 0.
+ */
+class RadixHeap : public FrontQueue
+{
+public:
+    static constexpr int BUCKET_COUNT = 33;
+    static constexpr std::uint32_t NOT_IN_HEAP = std::numeric_limits<std::uint32_t>::max();
+
+private:
+    // La redistribution des seaux est faite à la demande par top() (logiquement constant)
+    mutable std::vector<FrontEntry> buckets[BUCKET_COUNT];
+    mutable std::uint32_t last_key;             ///< Bits de la dernière clé extraite
+    mutable std::vector<std::uint8_t> bucket_of; ///< Seau de chaque cellule
+    mutable std::vector<std::uint32_t> slot_of;  ///< Position de chaque cellule dans son seau
+    size_t count;
+
+public:
+    RadixHeap();
+
+    void resize(long long cell_count) override;
+    void clear() override;
+
+    bool empty() const override { return count == 0; }
+    size_t size() const override { return count; }
+    long long capacity() const override { return static_cast<long long>(slot_of.size()); }
+    bool contains(long long index) const override { return slot_of[index] != NOT_IN_HEAP; }
+
+    FrontEntry top() const override;
+    FrontEntry pop() override;
+    bool push(long long index, float key) override;
+    void erase(long long index) override;
+
+    std::string get_name() const override { return "RadixHeap"; }
+
+private:
+    static std::uint32_t key_bits(float key);
+    int bucket_for(std::uint32_t bits) const;
+    void insert(long long index, float key) const;
+    void remove(long long index);
+
+    /**
+     * @brief Garantit que le seau 0 est non vide (redistribue le premier seau non vide)
+     */
+    void refill() const;
+};
+
+#endif // RADIXHEAP_HPP
@@ -0,0 +1,21 @@
+#include "Cell.hpp"
+
+GridShape::GridShape() : dims(), strides(), total(0) {}
+
+GridShape::GridShape(const std::vector<int>& dimensions) : dims(dimensions), strides(dimensions.size()), total(1)
+{
+    for (int i = static_cast<int>(dims.size()) - 1; i >= 0; i--) {
+        strides[i] = total;
+        total *= dims[i];
+    }
+    if (dims.empty()) total = 0;
+}
+
+std::vector<float> Cell::get_coords() const
+{
+    std::vector<float> coords(get_dim());
+    for (int i = 0; i < get_dim(); i++) {
+        coords[i] = static_cast<float>(coord(i));
+    }
+    return coords;
+}
@@ -1,9 +1,13 @@
 #include "Environnement.hpp"
 #include <stdexcept>
+#include <atomic>
 #include <iostream>
 #include <algorithm>
 #include <random>
 #include <chrono>
+#include <cmath>
+#include <fstream>
+#include "utils/BinaryIO.hpp"
 
 // Pour STB
 #define STB_IMAGE_IMPLEMENTATION
@@ -11,16 +15,80 @@
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include <stb/stb_image_write.h>
 
-Environnement::Environnement() : pointMap(), dims() {}
+namespace {
 
-Environnement::Environnement(const Environnement& env) : pointMap(env.get_map()), dims(env.get_dims()) {}
+/**
+ * @brief Charge une image et la ramène à un niveau de gris par pixel (moyenne des canaux RGB)
+ * @return Pixels ligne par ligne (y * width + x)
+ * @throws std::runtime_error si l'image ne peut pas être chargée
+ */
+std::vector<unsigned char> load_gray_image(const std::string& filename, int& width, int& height)
+{
+    int channels;
+    unsigned char* image = stbi_load(filename.c_str(), &width, &height, &channels, 0);
+    
+    if (!image) {
+        throw std::runtime_error("Impossible de charger l'image: " + filename);
+    }
+    
+    std::cout << "Image chargée: " << width << "x" << height << " avec " << channels << " canaux" << std::endl;
+
+    std::vector<unsigned char> gray(static_cast<size_t>(width) * height);
+    for (size_t pixel = 0; pixel < gray.size(); pixel++) {
+        const unsigned char* value = image + pixel * channels;
+        // Image en niveaux de gris, ou moyenne des canaux RGB (alpha ignoré)
+        gray[pixel] = channels < 3 ? value[0] : static_cast<unsigned char>((value[0] + value[1] + value[2]) / 3);
+    }
+
+    stbi_image_free(image);
+    return gray;
+}
+
+/**
+ * @brief Nouvelle version d'obstacles, jamais attribuée à un autre environnement
+ */
+std::uint64_t next_obstacle_version()
+{
+    static std::atomic<std::uint64_t> counter{0};
+    return ++counter;
+}
+
+void check_cost(float cost)
+{
+    if (!(cost > 0.0f) || std::isinf(cost)) {
+        throw std::invalid_argument("Coût de cellule invalide : il doit être fini et > 0");
+    }
+}
+
+}
+
+Environnement::Environnement(Backend storage)
+    : backend(storage), pointMap(), obstacleGrid(), shape(std::make_shared<GridShape>()), dims(), costGrid(), costVersion(0), costFieldVersion(0),
+      obstacleVersion(next_obstacle_version()) {}
+
+Environnement::Environnement(const Environnement& env)
+    : backend(env.backend), pointMap(env.pointMap), obstacleGrid(env.obstacleGrid), shape(env.shape), dims(env.get_dims()),
+      costGrid(env.costGrid), costVersion(env.costVersion), costFieldVersion(env.costFieldVersion),
+      obstacleVersion(env.obstacleVersion) {}
 
 void Environnement::set_dims(const std::vector<int>& dimensions) {
+    if (dimensions.size() > static_cast<size_t>(MAX_DIMS)) {
+        throw std::invalid_argument("Nombre de dimensions supérieur à MAX_DIMS");
+    }
     dims = dimensions;
+    shape = std::make_shared<GridShape>(dims);
+    obstacleVersion = next_obstacle_version();
+    if (!costGrid.empty()) clear_cost_field();
+
+    if (backend == DENSE) {
+        // Toutes les cellules existent : on les crée libres, les factories fixent ensuite obs
+        obstacleGrid.assign(shape->get_total(), 0);
+    }
 }
 
 void Environnement::addPoint(const Point& point) 
 {
+    obstacleVersion = next_obstacle_version();
     auto coords = point.get_coords();
     if (coords.size() == dims.size())
     {
@@ -31,7 +99,15 @@ void Environnement::addPoint(const Point& point)
                 throw std::invalid_argument("Coordinates alongside axis " + std::to_string(i) + " are out of bounds");
             }
         }
-        pointMap[point.get_coords()] = point;
+        if (backend == DENSE) {
+            long long index = dense_index(coords);
+            if (index < 0) {
+                throw std::invalid_argument("DENSE storage only accepts integer coordinates");
+            }
+            obstacleGrid[index] = point.get_obs();
+        } else {
+            pointMap[coords] = point;
+        }
     }
     else
     {
@@ -39,20 +115,94 @@ void Environnement::addPoint(const Point& point)
     }
 }
 
-Point& Environnement::getPoint(const std::vector<float>& coords)
+Point Environnement::getPoint(const std::vector<float>& coords) const
+{
+    if (backend == MAP) {
+        auto it = pointMap.find(coords);
+        if (it != pointMap.end()) return it->second;
+    } else {
+        long long index = dense_index(coords);
+        if (index >= 0) return point_at(index);
+    }
+    throw std::out_of_range("Point with given coordinates does not exist.");
+}
+
+bool Environnement::hasPoint(const std::vector<float>& coords) const {
+    if (backend == DENSE) return dense_index(coords) >= 0;
+    return pointMap.count(coords) > 0;
+}
+
+long long Environnement::index_of(const std::vector<float>& coords) const
 {
-    if (hasPoint(coords)) return pointMap.at(coords);
-    else throw std::out_of_range("Point with given coordinates does not exist.");
+    long long index = dense_index(coords);
+    if (index >= 0 && backend == MAP && pointMap.count(coords) == 0) return -1;
+    return index;
 }
 
-const Point& Environnement::getPoint(const std::vector<float>& coords) const
+bool Environnement::has_index(long long index) const
 {
-    if (hasPoint(coords)) return pointMap.at(coords);
-    else throw std::out_of_range("Point with given coordinates does not exist.");
+    if (index < 0 || index >= shape->get_total()) return false;
+    if (backend == DENSE) return true;
+    return pointMap.count(cell(index).get_coords()) > 0;
 }
 
-bool Environnement::hasPoint(const std::vector<float>& coords) const {
-    return pointMap.count(coords) > 0;
+Point Environnement::point_at(long long index) const
+{
+    if (backend == MAP) return pointMap.at(cell(index).get_coords());
+
+    Point point(static_cast<int>(dims.size()), cell(index).get_coords());
+    point.set_obs(obstacleGrid[index]);
+    return point;
+}
+
+bool Environnement::is_obstacle(long long index) const
+{
+    if (backend == DENSE) return obstacleGrid[index];
+    return pointMap.at(cell(index).get_coords()).get_obs();
+}
+
+void Environnement::set_obs(long long index, bool obstacle)
+{
+    obstacleVersion = next_obstacle_version();
+    if (backend == DENSE) {
+        obstacleGrid[index] = obstacle;
+        return;
+    }
+    std::vector<float> coords = cell(index).get_coords();
+    auto it = pointMap.find(coords);
+    if (it == pointMap.end()) {
+        it = pointMap.emplace(coords, Point(static_cast<int>(coords.size()), coords)).first;
+    }
+    it->second.set_obs(obstacle);
+}
+
+std::map<std::vector<float>, Point>& Environnement::get_map_ref()
+{
+    obstacleVersion = next_obstacle_version();
+    return pointMap;
+}
+
+std::uint64_t Environnement::get_obstacle_fingerprint() const
+{
+    std::uint64_t hash = 1469598103934665603ULL;
+    for (long long index = 0; index < shape->get_total(); index++) {
+        unsigned char state = has_index(index) ? (is_obstacle(index) ? 1 : 0) : 2;
+        hash = (hash ^ state) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+long long Environnement::dense_index(const std::vector<float>& coords) const
+{
+    if (coords.size() != dims.size()) return -1;
+
+    long long index = 0;
+    for (size_t i = 0; i < coords.size(); i++) {
+        float c = coords[i];
+        if (c < 0 || c >= dims[i] || c != std::floor(c)) return -1;
+        index = index * dims[i] + static_cast<long long>(c);
+    }
+    return index;
 }
 
 bool Environnement::is_in_bounds(const std::vector<float>& coords) const {
@@ -63,54 +213,44 @@ bool Environnement::is_in_bounds(const std::vector<float>& coords) const {
     return true;
 }
 
-std::vector<Point*> Environnement::get_neigh(const Point& pt)
+int Environnement::get_neigh(long long index, long long* neighbors) const
 {
-    std::vector<Point*> neigh;
-    auto coords = pt.get_coords();
+    int count = 0;
 
-    for (size_t i = 0; i < coords.size(); i++)
+    for (int i = 0; i < shape->get_dim(); i++)
     {
-        // Créer des coordonnées pour les voisins potentiels
-        std::vector<float> neighbor_coords_lower = coords;
-        std::vector<float> neighbor_coords_upper = coords;
-
-        // Décrémenter la coordonnée pour obtenir le voisin "inférieur"
-        neighbor_coords_lower[i] -= 1.0f;
-
-        // Incrémenter la coordonnée pour obtenir le voisin "supérieur"
-        neighbor_coords_upper[i] += 1.0f;
-
-        auto it_lower = pointMap.find(neighbor_coords_lower);
-        if (it_lower != pointMap.end())
-        {
-            neigh.push_back(&(it_lower->second));
+        // Voisins "inférieur" et "supérieur" le long de l'axe i, par décalage de l'index
+        int c = shape->coord(index, i);
+        long long stride = shape->stride(i);
+        long long lower = c > 0 ? index - stride : -1;
+        long long upper = c < dims[i] - 1 ? index + stride : -1;
+
+        if (backend == MAP) {
+            if (lower >= 0 && !has_index(lower)) lower = -1;
+            if (upper >= 0 && !has_index(upper)) upper = -1;
         }
-        else neigh.push_back(&(pointMap.find(neighbor_coords_upper)->second));
 
-        
-        auto it_upper = pointMap.find(neighbor_coords_upper);
-        if (it_upper != pointMap.end())
-        {
-            neigh.push_back(&(it_upper->second));
-        }
-        else neigh.push_back(&(pointMap.find(neighbor_coords_lower)->second));
+        // Au bord, le voisin manquant est remplacé par le voisin opposé (ou la cellule elle-même)
+        neighbors[count++] = lower >= 0 ? lower : (upper >= 0 ? upper : index);
+        neighbors[count++] = upper >= 0 ? upper : (lower >= 0 ? lower : index);
     }
-    return neigh;
+    return count;
 }
 
-Environnement Environnement::fromPNG(const std::string& filename, int obstacle_threshold)
+std::vector<long long> Environnement::get_neigh(const Cell& cell) const
 {
-    Environnement env;
+    long long neighbors[MAX_AXIS_NEIGHBORS];
+    int count = get_neigh(cell.get_index(), neighbors);
+    return std::vector<long long>(neighbors, neighbors + count);
+}
+
+Environnement Environnement::fromPNG(const std::string& filename, int obstacle_threshold, Backend storage)
+{
+    Environnement env(storage);
     
     // Charger l'image
-    int width, height, channels;
-    unsigned char* image = stbi_load(filename.c_str(), &width, &height, &channels, 0);
-    
-    if (!image) {
-        throw std::runtime_error("Impossible de charger l'image: " + filename);
-    }
-    
-    std::cout << "Image chargée: " << width << "x" << height << " avec " << channels << " canaux" << std::endl;
+    int width, height;
+    std::vector<unsigned char> image = load_gray_image(filename, width, height);
     
     // Définir les dimensions de l'environnement
     env.set_dims({width, height});
@@ -118,42 +258,91 @@ Environnement Environnement::fromPNG(const std::string& filename, int obstacle_t
     // Parcourir chaque pixel de l'image
     for (int y = 0; y < height; y++) {
         for (int x = 0; x < width; x++) {
-            // Calculer l'index du pixel
-            int pixel_index = (y * width + x) * channels;
-            
-            // Obtenir la valeur du pixel (pour image en niveaux de gris ou RGB)
-            unsigned char pixel_value;
-            if (channels == 1) {
-                // Image en niveaux de gris
-                pixel_value = image[pixel_index];
-            } else {
-                // Image RGB/RGBA - prendre la moyenne des canaux RGB
-                int sum = image[pixel_index] + image[pixel_index + 1] + image[pixel_index + 2];
-                pixel_value = sum / 3;
-            }
-            
-            // Créer un point pour cette position
-            std::vector<float> coords = {static_cast<float>(x), static_cast<float>(y)};
-            Point point(2, coords);
-            
             // Déterminer si c'est un obstacle
             // Convention: pixel sombre = obstacle, pixel clair = libre
-            bool is_obstacle = pixel_value < obstacle_threshold;
-            point.set_obs(is_obstacle);
+            bool is_obstacle = image[y * width + x] < obstacle_threshold;
             
-            // Ajouter le point à l'environnement
-            env.addPoint(point);
+            // Ajouter la cellule à l'environnement
+            env.set_obs(coordinatesToIndex({x, y}, env.dims), is_obstacle);
         }
     }
     
-    // Libérer la mémoire de l'image
-    stbi_image_free(image);
-    
-    std::cout << "Environnement créé avec " << env.pointMap.size() << " points" << std::endl;
+    std::cout << "Environnement créé avec " << env.get_point_count() << " points" << std::endl;
     
     return env;
 }
 
+void Environnement::set_cost_field(const std::vector<float>& costs)
+{
+    if (static_cast<long long>(costs.size()) != shape->get_total()) {
+        throw std::invalid_argument("Le champ de coût doit contenir une valeur par cellule");
+    }
+    std::for_each(costs.begin(), costs.end(), check_cost);
+    costGrid = costs;
+    costVersion++;
+    costFieldVersion++;
+}
+
+void Environnement::set_cost(long long index, float cost)
+{
+    check_cost(cost);
+    if (costGrid.empty()) costGrid.assign(shape->get_total(), 1.0f);
+    costGrid[index] = cost;
+    costVersion++;
+}
+
+void Environnement::clear_cost_field()
+{
+    costGrid.clear();
+    costGrid.shrink_to_fit();
+    costVersion++;
+    costFieldVersion++;
+}
+
+float Environnement::get_min_cost() const
+{
+    return costGrid.empty() ? 1.0f : *std::min_element(costGrid.begin(), costGrid.end());
+}
+
+void Environnement::load_costs_from_png(const std::string& filename, float min_cost, float max_cost)
+{
+    if (dims.size() != 2) {
+        throw std::invalid_argument("Cette fonction ne fonctionne que pour des environnements 2D");
+    }
+    if (!(min_cost > 0.0f) || !(min_cost <= max_cost) || std::isinf(max_cost)) {
+        throw std::invalid_argument("Coûts extrêmes invalides : 0 < min_cost <= max_cost requis");
+    }
+
+    int width, height;
+    std::vector<unsigned char> image = load_gray_image(filename, width, height);
+    if (width != dims[0] || height != dims[1]) {
+        throw std::invalid_argument("L'image de coût doit avoir la taille de la grille");
+    }
+
+    std::vector<float> costs(shape->get_total());
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            // Même convention que fromPNG : clair = libre (coût faible), sombre = difficile
+            float darkness = 1.0f - image[y * width + x] / 255.0f;
+            costs[coordinatesToIndex({x, y}, dims)] = min_cost + (max_cost - min_cost) * darkness;
+        }
+    }
+    set_cost_field(costs);
+}
+
+void Environnement::load_costs_from_raw(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Impossible d'ouvrir le fichier de coût: " + filename);
+    }
+    std::vector<float> costs = BinaryIO::read_vector<float>(file, static_cast<size_t>(shape->get_total()));
+    if (file.peek() != std::ifstream::traits_type::eof()) {
+        throw std::runtime_error("Fichier de coût trop long pour la grille: " + filename);
+    }
+    set_cost_field(costs);
+}
+
 void Environnement::toPNG(const std::string& filename) const
 {
     if (dims.size() != 2) {
@@ -169,36 +358,18 @@ void Environnement::toPNG(const std::string& filename) const
     // Initialiser en blanc
     std::fill(image.begin(), image.end(), 255);
     
-    // Parcourir tous les points
-    for (const auto& pair : pointMap) {
-        const auto& coords = pair.first;
-        const Point& point = pair.second;
+    // Parcourir toutes les cellules (libre = blanc, déjà initialisé)
+    for (long long index = 0; index < shape->get_total(); index++) {
+        if (!has_index(index) || !is_obstacle(index)) continue;
         
-        int x = static_cast<int>(coords[0]);
-        int y = static_cast<int>(coords[1]);
+        int x = shape->coord(index, 0);
+        int y = shape->coord(index, 1);
+        int pixel_index = (y * width + x) * 3;
         
-        if (x >= 0 && x < width && y >= 0 && y < height) {
-            int pixel_index = (y * width + x) * 3;
-            
-            if (point.get_obs()) {
-                // Obstacle = noir
-                image[pixel_index] = 0;     // R
-                image[pixel_index + 1] = 0; // G
-                image[pixel_index + 2] = 0; // B
-            } else {
-                // Libre = blanc (déjà initialisé)
-                // On peut aussi marquer différemment selon l'état
-                if (point.get_state() == FROZEN) {
-                    image[pixel_index] = 100;     // R
-                    image[pixel_index + 1] = 100; // G
-                    image[pixel_index + 2] = 255; // B (bleuté)
-                } else if (point.get_state() == FRONT) {
-                    image[pixel_index] = 255;     // R
-                    image[pixel_index + 1] = 100; // G
-                    image[pixel_index + 2] = 100; // B (rougeâtre)
-                }
-            }
-        }
+        // Obstacle = noir
+        image[pixel_index] = 0;     // R
+        image[pixel_index + 1] = 0; // G
+        image[pixel_index + 2] = 0; // B
     }
     
     // Sauvegarder l'image
@@ -245,9 +416,10 @@ long long Environnement::calculateTotalPoints(const std::vector<int>& dimensions
 
 Environnement Environnement::createRandomEnvironment(const std::vector<int>& dimensions, 
                                                    double obstacle_probability, 
-                                                   unsigned int seed)
+                                                   unsigned int seed,
+                                                   Backend storage)
 {
-    Environnement env;
+    Environnement env(storage);
     
     // Vérifier que les dimensions sont valides
     if (dimensions.empty()) {
@@ -279,25 +451,11 @@ Environnement Environnement::createRandomEnvironment(const std::vector<int>& dim
     // Calculer le nombre total de points
     long long total_points = calculateTotalPoints(dimensions);
     
-    // Créer tous les points de l'environnement
+    // Créer toutes les cellules de l'environnement
     for (long long i = 0; i < total_points; i++) {
-        // Convertir l'index en coordonnées
-        std::vector<int> coords = indexToCoordinates(i, dimensions);
-        
-        // Convertir les coordonnées entières en float
-        std::vector<float> float_coords(coords.size());
-        for (size_t j = 0; j < coords.size(); j++) {
-            float_coords[j] = static_cast<float>(coords[j]);
-        }
-        
-        Point point(static_cast<int>(coords.size()), float_coords);
-        
         // Déterminer aléatoirement si c'est un obstacle
         bool is_obstacle = distribution(generator) < obstacle_probability;
-        point.set_obs(is_obstacle);
-        
-        // Ajouter le point à l'environnement
-        env.addPoint(point);
+        env.set_obs(i, is_obstacle);
     }
     
     // Afficher les informations
@@ -354,9 +512,10 @@ std::vector<std::vector<int>> Environnement::getPossibleDirections(int num_dimen
 }
 
 Environnement Environnement::createMazeEnvironment(const std::vector<int>& dimensions, 
-                                                 unsigned int seed)
+                                                 unsigned int seed,
+                                                 Backend storage)
 {
-    Environnement env;
+    Environnement env(storage);
     
     // Vérifier que les dimensions sont valides
     if (dimensions.empty()) {
@@ -443,17 +602,9 @@ Environnement Environnement::createMazeEnvironment(const std::vector<int>& dimen
         }
     }
     
-    // Convertir la grille en points
+    // Convertir la grille en cellules
     for (long long i = 0; i < total_points; i++) {
-        std::vector<int> coords = indexToCoordinates(i, dimensions);
-        std::vector<float> float_coords(coords.size());
-        for (size_t j = 0; j < coords.size(); j++) {
-            float_coords[j] = static_cast<float>(coords[j]);
-        }
-        
-        Point point(static_cast<int>(coords.size()), float_coords);
-        point.set_obs(obstacle_grid[i]); // true = obstacle
-        env.addPoint(point);
+        env.set_obs(i, obstacle_grid[i]); // true = obstacle
     }
     
     // Afficher les informations
@@ -469,10 +620,10 @@ Environnement Environnement::createMazeEnvironment(const std::vector<int>& dimen
 }
 
 
-std::vector<std::pair<Point*, float>> Environnement::get_hypercube_corners_with_weights(
+std::vector<std::pair<long long, float>> Environnement::get_hypercube_corners_with_weights(
     const std::vector<float>& query_coords) const {
 
-    std::vector<std::pair<Point*, float>> corners_with_points_and_weights; // Changement ici
+    std::vector<std::pair<long long, float>> corners_with_points_and_weights;
 
     if (!is_in_bounds(query_coords)) {
         return corners_with_points_and_weights;
@@ -512,57 +663,16 @@ std::vector<std::pair<Point*, float>> Environnement::get_hypercube_corners_with_
             }
         }
 
-        // Au lieu de retourner les coordonnées, nous obtenons le pointeur vers le Point.
-        // Puisque Environnement::getPoint retourne const Point&, nous pouvons prendre son adresse.
-        if (hasPoint(corner_coords)) {
-            corners_with_points_and_weights.emplace_back(const_cast<Point*>(&getPoint(corner_coords)), current_weight);
+        // On retourne l'index linéaire du coin : son état vit dans le SearchWorkspace
+        long long corner_index = index_of(corner_coords);
+        if (corner_index >= 0) {
+            corners_with_points_and_weights.emplace_back(corner_index, current_weight);
         }
     }
 
     return corners_with_points_and_weights;
 }
 
-float Environnement::interpolate_from_corners(const std::vector<float>& coords) const { // 'corner_values' n'est plus nécessaire
-
-    // Appel de la version modifiée qui retourne des Point*
-    auto corners_with_points_and_weights = get_hypercube_corners_with_weights(coords);
-
-    if (corners_with_points_and_weights.empty()) {
-        return std::numeric_limits<float>::infinity();
-    }
-
-    float interpolated_value = 0.0f;
-    float total_weight = 0.0f;
-
-    for (const auto& entry : corners_with_points_and_weights) {
-        const Point* corner_point = entry.first; // Pointeur vers le Point
-        float weight = entry.second;             // Poids d'interpolation
-
-        // Accès direct à la valeur du point
-        interpolated_value += weight * corner_point->get_value();
-        total_weight += weight;
-    }
-
-    return (total_weight > 0) ? interpolated_value / total_weight : std::numeric_limits<float>::infinity();
-}
-
-bool Environnement::are_all_corners_frozen(const std::vector<float>& coords) const {
-    auto corners_with_points_and_weights = get_hypercube_corners_with_weights(coords);
-
-    if (corners_with_points_and_weights.empty()) {
-        return false;
-    }
-
-    for (const auto& entry : corners_with_points_and_weights) {
-        const Point* corner_point = entry.first;
-        if (corner_point->get_state() != FROZEN) { // Accès direct à l'état
-            return false;
-        }
-    }
-
-    return true;
-}
-
 float Environnement::calculate_distance(const std::vector<float>& a, const std::vector<float>& b, int norm_type) const {
     if (a.size() != b.size()) {
         throw std::invalid_argument("Les vecteurs doivent avoir la même taille");
@@ -590,4 +700,29 @@ float Environnement::calculate_distance(const std::vector<float>& a, const std::
     }
     
     return distance;
-}
\ No newline at end of file
+}
+float Environnement::calculate_distance(const Cell& a, const std::vector<float>& b, int norm_type) const {
+    if (static_cast<size_t>(a.get_dim()) != b.size()) {
+        throw std::invalid_argument("Les vecteurs doivent avoir la même taille");
+    }
+
+    float distance = 0.0f;
+
+    for (int i = 0; i < a.get_dim(); ++i) {
+        float diff = std::abs(static_cast<float>(a.coord(i)) - b[i]);
+
+        if (norm_type == 1) {
+            distance += diff;
+        } else if (norm_type == 2) {
+            distance += diff * diff;
+        } else {
+            distance = std::max(distance, diff);
+        }
+    }
+
+    if (norm_type == 2) {
+        distance = std::sqrt(distance);
+    }
+
+    return distance;
+}
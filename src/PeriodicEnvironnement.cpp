@@ -8,8 +8,9 @@
 
 PeriodicEnvironnement::PeriodicEnvironnement() : Environnement(), periodic_dims() {}
 
-PeriodicEnvironnement::PeriodicEnvironnement(const std::vector<int>& dimensions, const std::vector<bool>& periodic) 
-    : Environnement(), periodic_dims(periodic) 
+PeriodicEnvironnement::PeriodicEnvironnement(const std::vector<int>& dimensions, const std::vector<bool>& periodic,
+                                             Backend storage) 
+    : Environnement(storage), periodic_dims(periodic) 
 {
     set_dims(dimensions);
     validate_periodic_dims();
@@ -54,40 +55,35 @@ bool PeriodicEnvironnement::is_in_bounds(const std::vector<float>& coords) const
     return true;
 }
 
-std::vector<Point*> PeriodicEnvironnement::get_neigh(const Point& pt) {
-    std::vector<Point*> neigh;
-    auto coords = pt.get_coords();
+int PeriodicEnvironnement::get_neigh(long long index, long long* neighbors) const {
+    int count = 0;
 
-    for (size_t i = 0; i < coords.size(); ++i) {
-        // Voisin "inférieur" (coords[i] - 1)
-        std::vector<float> neighbor_coords_lower = coords;
-        neighbor_coords_lower[i] -= 1.0f;
-        
-        // Voisin "supérieur" (coords[i] + 1)  
-        std::vector<float> neighbor_coords_upper = coords;
-        neighbor_coords_upper[i] += 1.0f;
-        
-        // Normaliser les coordonnées selon la périodicité
-        neighbor_coords_lower = normalize_coords(neighbor_coords_lower);
-        neighbor_coords_upper = normalize_coords(neighbor_coords_upper);
-        
-        // Ajouter les voisins s'ils existent et sont dans les bornes
-        if (is_in_bounds(neighbor_coords_lower) && hasPoint(neighbor_coords_lower)) {
-            neigh.push_back(&getPoint(neighbor_coords_lower));
-        }
-        
-        if (is_in_bounds(neighbor_coords_upper) && hasPoint(neighbor_coords_upper)) {
-            neigh.push_back(&getPoint(neighbor_coords_upper));
+    for (int i = 0; i < shape->get_dim(); ++i) {
+        int c = shape->coord(index, i);
+        long long stride = shape->stride(i);
+        long long wrap = stride * (dims[i] - 1); // Saut vers le bord opposé de l'axe
+
+        // Voisins inférieur / supérieur, repliés sur le bord opposé si l'axe est périodique
+        long long lower = c > 0 ? index - stride : (is_periodic(i) ? index + wrap : -1);
+        long long upper = c < dims[i] - 1 ? index + stride : (is_periodic(i) ? index - wrap : -1);
+
+        if (backend == MAP) {
+            if (lower >= 0 && !has_index(lower)) lower = -1;
+            if (upper >= 0 && !has_index(upper)) upper = -1;
         }
+
+        // Bord d'un axe non périodique : même convention que Environnement
+        neighbors[count++] = lower >= 0 ? lower : (upper >= 0 ? upper : index);
+        neighbors[count++] = upper >= 0 ? upper : (lower >= 0 ? lower : index);
     }
     
-    return neigh;
+    return count;
 }
 
-std::vector<std::pair<Point*, float>> PeriodicEnvironnement::get_hypercube_corners_with_weights(
+std::vector<std::pair<long long, float>> PeriodicEnvironnement::get_hypercube_corners_with_weights(
     const std::vector<float>& query_coords) const {
     
-    std::vector<std::pair<Point*, float>> corners_with_points_and_weights;
+    std::vector<std::pair<long long, float>> corners_with_points_and_weights;
 
     if (!is_in_bounds(query_coords)) {
         return corners_with_points_and_weights;
@@ -140,9 +136,9 @@ std::vector<std::pair<Point*, float>> PeriodicEnvironnement::get_hypercube_corne
         // Normaliser les coordonnées du coin (pour gérer le wraparound périodique)
         corner_coords = normalize_coords(corner_coords);
 
-        if (hasPoint(corner_coords)) {
-            corners_with_points_and_weights.emplace_back(
-                const_cast<Point*>(&getPoint(corner_coords)), current_weight);
+        long long corner_index = index_of(corner_coords);
+        if (corner_index >= 0) {
+            corners_with_points_and_weights.emplace_back(corner_index, current_weight);
         }
     }
 
@@ -178,14 +174,41 @@ float PeriodicEnvironnement::calculate_distance(const std::vector<float>& a, con
     return distance;
 }
 
+float PeriodicEnvironnement::calculate_distance(const Cell& a, const std::vector<float>& b, int norm_type) const {
+    if (static_cast<size_t>(a.get_dim()) != b.size() || b.size() != dims.size()) {
+        throw std::invalid_argument("Les vecteurs doivent avoir la même taille que le nombre de dimensions");
+    }
+
+    float distance = 0.0f;
+
+    for (int i = 0; i < a.get_dim(); ++i) {
+        float dim_distance = calculate_dimension_distance(static_cast<float>(a.coord(i)), b[i], dims[i], is_periodic(i));
+
+        if (norm_type == 1) {
+            distance += dim_distance;
+        } else if (norm_type == 2) {
+            distance += dim_distance * dim_distance;
+        } else {
+            distance = std::max(distance, dim_distance);
+        }
+    }
+
+    if (norm_type == 2) {
+        distance = std::sqrt(distance);
+    }
+
+    return distance;
+}
+
 // Factory methods
 std::unique_ptr<PeriodicEnvironnement> PeriodicEnvironnement::createPeriodicRandomEnvironment(
     const std::vector<int>& dimensions,
     const std::vector<bool>& periodic,
     double obstacle_probability,
-    unsigned int seed) {
+    unsigned int seed,
+    Backend storage) {
     
-    auto env = std::make_unique<PeriodicEnvironnement>(dimensions, periodic);
+    auto env = std::make_unique<PeriodicEnvironnement>(dimensions, periodic, storage);
     
     // Initialiser le générateur de nombres aléatoires
     std::mt19937 generator;
@@ -202,19 +225,10 @@ std::unique_ptr<PeriodicEnvironnement> PeriodicEnvironnement::createPeriodicRand
     // Calculer le nombre total de points
     long long total_points = calculateTotalPoints(dimensions);
     
-    // Créer tous les points
+    // Créer toutes les cellules
     for (long long i = 0; i < total_points; ++i) {
-        std::vector<int> coords = indexToCoordinates(i, dimensions);
-        std::vector<float> float_coords(coords.size());
-        for (size_t j = 0; j < coords.size(); ++j) {
-            float_coords[j] = static_cast<float>(coords[j]);
-        }
-        
-        Point point(static_cast<int>(coords.size()), float_coords);
         bool is_obstacle = distribution(generator) < obstacle_probability;
-        point.set_obs(is_obstacle);
-        
-        env->addPoint(point);
+        env->set_obs(i, is_obstacle);
     }
     
     std::cout << "Environnement périodique aléatoire créé ";
@@ -232,9 +246,10 @@ std::unique_ptr<PeriodicEnvironnement> PeriodicEnvironnement::createPeriodicRand
 std::unique_ptr<PeriodicEnvironnement> PeriodicEnvironnement::createPeriodicMazeEnvironment(
     const std::vector<int>& dimensions,
     const std::vector<bool>& periodic,
-    unsigned int seed) {
+    unsigned int seed,
+    Backend storage) {
     
-    auto env = std::make_unique<PeriodicEnvironnement>(dimensions, periodic);
+    auto env = std::make_unique<PeriodicEnvironnement>(dimensions, periodic, storage);
     
     // Pour l'instant, utiliser la même logique que createMazeEnvironment
     // mais il faudrait adapter l'algorithme pour tenir compte de la périodicité
@@ -306,17 +321,9 @@ std::unique_ptr<PeriodicEnvironnement> PeriodicEnvironnement::createPeriodicMaze
         }
     }
     
-    // Convertir en points
+    // Convertir en cellules
     for (long long i = 0; i < total_points; ++i) {
-        std::vector<int> coords = indexToCoordinates(i, dimensions);
-        std::vector<float> float_coords(coords.size());
-        for (size_t j = 0; j < coords.size(); ++j) {
-            float_coords[j] = static_cast<float>(coords[j]);
-        }
-        
-        Point point(static_cast<int>(coords.size()), float_coords);
-        point.set_obs(obstacle_grid[i]);
-        env->addPoint(point);
+        env->set_obs(i, obstacle_grid[i]);
     }
     
     std::cout << "Labyrinthe périodique créé ";
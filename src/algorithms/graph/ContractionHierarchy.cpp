@@ -0,0 +1,409 @@
+#include "algorithms/graph/ContractionHierarchy.hpp"
+#include "utils/BinaryIO.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+constexpr float INF = std::numeric_limits<float>::infinity();
+const char MAGIC[4] = {'C', 'H', '0', '1'};
+
+/**
+ * @brief Graphe restant pendant la contraction (nœuds non encore contractés)
+ */
+class Contractor
+{
+public:
+    using Arc = ContractionHierarchy::Arc;
+
+    std::vector<std::vector<Arc>> graph;
+    std::vector<int> contracted_neighbors;
+
+private:
+    int witness_limit;
+    std::vector<float> witness_distance;
+    std::vector<int> touched;
+    IndexedHeap witness_heap;
+
+public:
+    Contractor(int node_count, int settle_limit)
+        : graph(node_count), contracted_neighbors(node_count, 0), witness_limit(settle_limit),
+          witness_distance(node_count, INF)
+    {
+        witness_heap.resize(node_count);
+    }
+
+    /**
+     * @brief Ajoute l'arête u - w ou raccourcit l'arête existante
+     */
+    void add_edge(int u, int w, float cost, int middle)
+    {
+        for (int side = 0; side < 2; side++) {
+            int from = side == 0 ? u : w, to = side == 0 ? w : u;
+            auto it = std::find_if(graph[from].begin(), graph[from].end(), [to](const Arc& arc) { return arc.target == to; });
+            if (it == graph[from].end()) {
+                graph[from].push_back({to, cost, middle});
+            } else if (cost < it->cost) {
+                *it = {to, cost, middle};
+            }
+        }
+    }
+
+    /**
+     * @brief Raccourcis nécessaires pour contracter v (ajoutés si apply)
+     */
+    int contract(int v, bool apply)
+    {
+        const std::vector<Arc> neighbors = graph[v];
+        int shortcuts = 0;
+        for (size_t i = 0; i + 1 < neighbors.size(); i++) {
+            float max_cost = 0.0f;
+            for (size_t j = i + 1; j < neighbors.size(); j++) max_cost = std::max(max_cost, neighbors[j].cost);
+            witness_search(neighbors[i].target, v, neighbors[i].cost + max_cost);
+
+            for (size_t j = i + 1; j < neighbors.size(); j++) {
+                float via = neighbors[i].cost + neighbors[j].cost;
+                if (witness_distance[neighbors[j].target] <= via) continue;
+                shortcuts++;
+                if (apply) add_edge(neighbors[i].target, neighbors[j].target, via, v);
+            }
+            for (int node : touched) witness_distance[node] = INF;
+            touched.clear();
+        }
+        return shortcuts;
+    }
+
+    float priority(int v)
+    {
+        return static_cast<float>(contract(v, false) - static_cast<int>(graph[v].size()) + contracted_neighbors[v]);
+    }
+
+    /**
+     * @brief Retire v du graphe restant
+     */
+    void remove(int v)
+    {
+        for (const Arc& arc : graph[v]) {
+            std::vector<Arc>& other = graph[arc.target];
+            other.erase(std::remove_if(other.begin(), other.end(), [v](const Arc& a) { return a.target == v; }), other.end());
+            contracted_neighbors[arc.target]++;
+        }
+        graph[v].clear();
+    }
+
+private:
+    /**
+     * @brief Dijkstra depuis source évitant avoid, borné en distance et en nœuds établis
+     */
+    void witness_search(int source, int avoid, float max_cost)
+    {
+        witness_distance[source] = 0.0f;
+        touched.push_back(source);
+        witness_heap.push(source, 0.0f);
+        int settled = 0;
+        while (!witness_heap.empty()) {
+            FrontEntry entry = witness_heap.pop();
+            if (entry.value > max_cost || ++settled > witness_limit) break;
+            for (const Arc& arc : graph[entry.index]) {
+                if (arc.target == avoid) continue;
+                float candidate = entry.value + arc.cost;
+                if (candidate < witness_distance[arc.target]) {
+                    if (std::isinf(witness_distance[arc.target])) touched.push_back(arc.target);
+                    witness_distance[arc.target] = candidate;
+                    witness_heap.push(arc.target, candidate);
+                }
+            }
+        }
+        witness_heap.clear();
+    }
+};
+
+}
+
+// =====================================================================
+// ContractionHierarchy
+// =====================================================================
+
+ContractionHierarchy::ContractionHierarchy(const Environnement* environment, float cost, int witness_settle_limit)
+    : env(environment), edge_cost(cost), witness_limit(witness_settle_limit), shortcut_count(0)
+{
+    if (!env) throw std::invalid_argument("ContractionHierarchy: null environment.");
+    if (!(cost > 0.0f)) throw std::invalid_argument("ContractionHierarchy: edge cost must be positive.");
+    if (witness_limit < 1) throw std::invalid_argument("ContractionHierarchy: witness limit must be at least 1.");
+}
+
+void ContractionHierarchy::build_nodes()
+{
+    long long total = env->get_shape().get_total();
+    node_of_cell.assign(total, -1);
+    cell_of_node.clear();
+    for (long long cell = 0; cell < total; cell++) {
+        if (!env->has_index(cell) || env->is_obstacle(cell)) continue;
+        node_of_cell[cell] = static_cast<int>(cell_of_node.size());
+        cell_of_node.push_back(cell);
+    }
+}
+
+void ContractionHierarchy::build()
+{
+    build_nodes();
+    int node_count = get_node_count();
+    Contractor contractor(node_count, witness_limit);
+
+    long long neighbors[Environnement::MAX_AXIS_NEIGHBORS];
+    for (int node = 0; node < node_count; node++) {
+        int count = env->get_neigh(cell_of_node[node], neighbors);
+        for (int k = 0; k < count; k++) {
+            int other = node_of(neighbors[k]);
+            if (other >= 0 && other != node) contractor.add_edge(node, other, edge_cost, -1);
+        }
+    }
+
+    IndexedHeap order;
+    order.resize(node_count);
+    for (int node = 0; node < node_count; node++) order.push(node, contractor.priority(node));
+
+    std::vector<std::vector<Arc>> upward(node_count);
+    rank.assign(node_count, -1);
+    int level = 0;
+    while (!order.empty()) {
+        int v = static_cast<int>(order.pop().index);
+        float priority = contractor.priority(v);
+        if (!order.empty() && priority > order.top().value) {
+            order.push(v, priority);
+            continue;
+        }
+
+        contractor.contract(v, true);
+        upward[v] = contractor.graph[v];
+        rank[v] = level++;
+        for (const Arc& arc : contractor.graph[v]) {
+            if (order.contains(arc.target)) order.push(arc.target, order.get_key(arc.target) + 1.0f);
+        }
+        contractor.remove(v);
+    }
+
+    first_arc.assign(node_count + 1, 0);
+    for (int node = 0; node < node_count; node++) first_arc[node + 1] = first_arc[node] + static_cast<int>(upward[node].size());
+    arcs.clear();
+    arcs.reserve(first_arc[node_count]);
+    shortcut_count = 0;
+    for (int node = 0; node < node_count; node++) {
+        for (const Arc& arc : upward[node]) {
+            if (arc.middle >= 0) shortcut_count++;
+            arcs.push_back(arc);
+        }
+    }
+}
+
+void ContractionHierarchy::unpack(int a, int b, std::vector<int>& path) const
+{
+    int lower = rank[a] < rank[b] ? a : b;
+    int upper = lower == a ? b : a;
+    const Arc* edge = nullptr;
+    for (int arc = first_arc[lower]; arc < first_arc[lower + 1]; arc++) {
+        if (arcs[arc].target == upper && (!edge || arcs[arc].cost < edge->cost)) edge = &arcs[arc];
+    }
+    if (!edge) throw std::logic_error("ContractionHierarchy::unpack: no arc between the two nodes.");
+
+    if (edge->middle < 0) {
+        path.push_back(b);
+    } else {
+        unpack(a, edge->middle, path);
+        unpack(edge->middle, b, path);
+    }
+}
+
+void ContractionHierarchy::save(const std::string& filename) const
+{
+    if (!is_built()) throw std::logic_error("ContractionHierarchy::save: hierarchy not built.");
+    std::ofstream file(filename, std::ios::binary);
+    if (!file) throw std::runtime_error("ContractionHierarchy::save: cannot open " + filename);
+
+    const GridShape& shape = env->get_shape();
+    file.write(MAGIC, sizeof(MAGIC));
+    BinaryIO::write_value<std::int32_t>(file, shape.get_dim());
+    for (int i = 0; i < shape.get_dim(); i++) BinaryIO::write_value<std::int32_t>(file, shape.size(i));
+    BinaryIO::write_value<std::uint64_t>(file, env->get_obstacle_fingerprint());
+    BinaryIO::write_value<float>(file, edge_cost);
+    BinaryIO::write_value<std::int32_t>(file, get_node_count());
+    BinaryIO::write_value<std::int64_t>(file, get_arc_count());
+    BinaryIO::write_value<std::int64_t>(file, shortcut_count);
+    std::vector<std::int64_t> cells(cell_of_node.begin(), cell_of_node.end());
+    BinaryIO::write_vector(file, cells);
+    BinaryIO::write_vector(file, rank);
+    BinaryIO::write_vector(file, first_arc);
+    BinaryIO::write_vector(file, arcs);
+    if (!file) throw std::runtime_error("ContractionHierarchy::save: write failed for " + filename);
+}
+
+void ContractionHierarchy::load(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) throw std::runtime_error("ContractionHierarchy::load: cannot open " + filename);
+
+    char magic[sizeof(MAGIC)];
+    file.read(magic, sizeof(magic));
+    if (!file || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("ContractionHierarchy::load: not a contraction hierarchy file: " + filename);
+    }
+
+    const GridShape& shape = env->get_shape();
+    bool same_shape = BinaryIO::read_value<std::int32_t>(file) == shape.get_dim();
+    for (int i = 0; same_shape && i < shape.get_dim(); i++) {
+        same_shape = BinaryIO::read_value<std::int32_t>(file) == shape.size(i);
+    }
+    if (!same_shape || BinaryIO::read_value<std::uint64_t>(file) != env->get_obstacle_fingerprint()) {
+        throw std::runtime_error("ContractionHierarchy::load: " + filename + " was computed on another map.");
+    }
+    if (BinaryIO::read_value<float>(file) != edge_cost) {
+        throw std::runtime_error("ContractionHierarchy::load: " + filename + " uses another edge cost.");
+    }
+
+    // Les nœuds ne dépendent que des obstacles, dont l'empreinte vient d'être vérifiée
+    build_nodes();
+    const std::string corrupted = "ContractionHierarchy::load: " + filename + " is corrupted.";
+    int node_count = BinaryIO::read_value<std::int32_t>(file);
+    long long arc_count = BinaryIO::read_value<std::int64_t>(file);
+    long long loaded_shortcuts = BinaryIO::read_value<std::int64_t>(file);
+    if (node_count != get_node_count()) {
+        throw std::runtime_error("ContractionHierarchy::load: " + filename + " was computed on another map.");
+    }
+    if (arc_count < 0 || arc_count > std::numeric_limits<int>::max() || loaded_shortcuts < 0 || loaded_shortcuts > arc_count) {
+        throw std::runtime_error(corrupted);
+    }
+    std::vector<std::int64_t> cells = BinaryIO::read_vector<std::int64_t>(file, node_count);
+    std::vector<int> loaded_rank = BinaryIO::read_vector<int>(file, node_count);
+    std::vector<int> loaded_first = BinaryIO::read_vector<int>(file, static_cast<size_t>(node_count) + 1);
+    std::vector<Arc> loaded_arcs = BinaryIO::read_vector<Arc>(file, arc_count);
+    if (!std::equal(cells.begin(), cells.end(), cell_of_node.begin())) {
+        throw std::runtime_error("ContractionHierarchy::load: " + filename + " was computed on another map.");
+    }
+
+    // Rangs : permutation de [0, node_count)
+    std::vector<char> rank_used(node_count, 0);
+    for (int r : loaded_rank) {
+        if (r < 0 || r >= node_count || rank_used[r]) throw std::runtime_error(corrupted);
+        rank_used[r] = 1;
+    }
+    // Arcs : tableau d'offsets croissant couvrant tous les arcs, arcs montants vers des nœuds existants
+    if (loaded_first.front() != 0 || loaded_first.back() != arc_count) throw std::runtime_error(corrupted);
+    for (int node = 0; node < node_count; node++) {
+        if (loaded_first[node + 1] < loaded_first[node] || loaded_first[node + 1] > arc_count) {
+            throw std::runtime_error(corrupted);
+        }
+        for (int a = loaded_first[node]; a < loaded_first[node + 1]; a++) {
+            const Arc& arc = loaded_arcs[a];
+            if (arc.target < 0 || arc.target >= node_count || loaded_rank[arc.target] <= loaded_rank[node] ||
+                arc.middle < -1 || arc.middle >= node_count || !(arc.cost >= 0.0f) || std::isinf(arc.cost)) {
+                throw std::runtime_error(corrupted);
+            }
+        }
+    }
+    rank = std::move(loaded_rank);
+    first_arc = std::move(loaded_first);
+    arcs = std::move(loaded_arcs);
+    shortcut_count = loaded_shortcuts;
+}
+
+// =====================================================================
+// CHQuery
+// =====================================================================
+
+CHQuery::CHQuery(const ContractionHierarchy* contraction_hierarchy)
+    : hierarchy(contraction_hierarchy), meeting(-1), best(INF), settled(0)
+{
+    if (!hierarchy || !hierarchy->is_built()) {
+        throw std::invalid_argument("CHQuery: the contraction hierarchy must be built or loaded.");
+    }
+    int node_count = hierarchy->get_node_count();
+    for (int side = 0; side < 2; side++) {
+        distances[side].assign(node_count, INF);
+        parents[side].assign(node_count, -1);
+        queues[side].resize(node_count);
+    }
+}
+
+void CHQuery::reset()
+{
+    for (int node : touched) {
+        for (int side = 0; side < 2; side++) {
+            distances[side][node] = INF;
+            parents[side][node] = -1;
+        }
+    }
+    touched.clear();
+    queues[0].clear();
+    queues[1].clear();
+    meeting = -1;
+    best = INF;
+    settled = 0;
+}
+
+float CHQuery::distance(long long source_cell, long long target_cell)
+{
+    reset();
+    int source = hierarchy->node_of(source_cell);
+    int target = hierarchy->node_of(target_cell);
+    if (source < 0 || target < 0) return INF;
+
+    distances[0][source] = 0.0f;
+    distances[1][target] = 0.0f;
+    touched.push_back(source);
+    touched.push_back(target);
+    queues[0].push(source, 0.0f);
+    queues[1].push(target, 0.0f);
+
+    while (!queues[0].empty() || !queues[1].empty()) {
+        int side;
+        if (queues[0].empty()) side = 1;
+        else if (queues[1].empty()) side = 0;
+        else side = queues[0].top().value <= queues[1].top().value ? 0 : 1;
+        if (queues[side].top().value >= best) break;
+
+        int node = static_cast<int>(queues[side].pop().index);
+        settled++;
+        float total = distances[side][node] + distances[1 - side][node];
+        if (total < best) {
+            best = total;
+            meeting = node;
+        }
+
+        for (int arc = hierarchy->arcs_begin(node); arc < hierarchy->arcs_end(node); arc++) {
+            const ContractionHierarchy::Arc& edge = hierarchy->get_arc(arc);
+            float candidate = distances[side][node] + edge.cost;
+            if (candidate < distances[side][edge.target]) {
+                if (std::isinf(distances[0][edge.target]) && std::isinf(distances[1][edge.target])) {
+                    touched.push_back(edge.target);
+                }
+                distances[side][edge.target] = candidate;
+                parents[side][edge.target] = node;
+                queues[side].push(edge.target, candidate);
+            }
+        }
+    }
+    return best;
+}
+
+std::vector<long long> CHQuery::get_path() const
+{
+    if (meeting < 0) return {};
+
+    std::vector<int> hops;
+    for (int node = meeting; node >= 0; node = parents[0][node]) hops.push_back(node);
+    std::reverse(hops.begin(), hops.end());
+    for (int node = parents[1][meeting]; node >= 0; node = parents[1][node]) hops.push_back(node);
+
+    std::vector<int> nodes = {hops.front()};
+    for (size_t i = 1; i < hops.size(); i++) hierarchy->unpack(hops[i - 1], hops[i], nodes);
+
+    std::vector<long long> path;
+    path.reserve(nodes.size());
+    for (int node : nodes) path.push_back(hierarchy->get_cell(node));
+    return path;
+}
@@ -11,12 +11,28 @@ float Dijkstra::get_edge_cost() const {
     return edge_cost;
 }
 
-float Dijkstra::calculate_new_value(const Point* current, const Point* neighbor) {
-    // Pour Dijkstra basique: nouvelle valeur = valeur actuelle + coût d'arête constant
-    // Dans le futur, on pourrait calculer la distance euclidienne réelle entre current et neighbor
-    // ou utiliser des coûts d'arêtes variables selon le terrain
-    
-    (void)neighbor; // Éviter warning unused parameter pour l'instant
-    
-    return current->get_value() + edge_cost;
-}
\ No newline at end of file
+float Dijkstra::calculate_new_value(long long current, long long neighbor, float step_length) {
+    // Terrain : l'arête traverse une demi-cellule de chaque côté (symétrique, ce que suppose IncrementalDijkstra)
+    const float* costs = env->get_cost_data();
+    if (costs) step_length *= 0.5f * (costs[current] + costs[neighbor]);
+
+    return workspace.get_value(current) + edge_cost * step_length;
+}
+
+float Dijkstra::get_bucket_width() const {
+    return edge_cost * env->get_min_cost() * (neighborhood ? neighborhood->get_min_cost() : 1.0f);
+}
+
+bool Dijkstra::run_fixed_dimension_loop() {
+    const float* costs = env->get_cost_data();
+    if (costs) {
+        auto update = [this, costs](const auto&, long long current, long long neighbor, const auto&) {
+            return workspace.get_value(current) + edge_cost * (0.5f * (costs[current] + costs[neighbor]));
+        };
+        return run_fixed_dimension(update);
+    }
+    auto update = [this](const auto&, long long current, long long, const auto&) {
+        return workspace.get_value(current) + edge_cost;
+    };
+    return run_fixed_dimension(update);
+}
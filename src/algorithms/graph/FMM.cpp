@@ -1,10 +1,11 @@
 #include "algorithms/graph/FMM.hpp"
 #include "utils/Comparison.hpp"
-#include <numeric>
+#include <cmath>
+#include <type_traits>
 
 
 FMM::FMM(Environnement* environment, float distance_cost) 
-    : GraphSearchBase(environment), cost_per_unit_distance(distance_cost) {}
+    : GraphSearchBase(environment), cost_per_unit_distance(distance_cost), stencil_order(FIRST_ORDER) {}
 
 void FMM::set_cost_per_unit_distance(float distance_cost) {
     cost_per_unit_distance = distance_cost;
@@ -14,19 +15,83 @@ float FMM::get_cost_per_unit_distance() const {
     return cost_per_unit_distance;
 }
 
-float FMM::calculate_new_value(const Point* current, const Point* neighbor) {
+float FMM::get_bucket_width() const {
+    return cost_per_unit_distance * env->get_min_cost() / std::sqrt(static_cast<float>(env->get_dims().size()));
+}
+
+float FMM::calculate_new_value(long long current, long long neighbor, float step_length) {
 
     //(void)neighbor; // Éviter warning unused parameter pour l'instant
     (void)current;
-    auto neighs = env->get_neigh(*neighbor);
-    auto coords = neighbor->get_coords();
-    std::vector<Point*> contributing_neighs;
-    for (size_t i = 0; i < neighs.size(); i+=2)
+    (void)step_length;
+    long long neighs[Environnement::MAX_AXIS_NEIGHBORS];
+    float contributing_values[Environnement::MAX_DIMS];
+    int neigh_count = env->get_neigh(neighbor, neighs);
+    int axis_count = 0;
+    if (stencil_order == SECOND_ORDER) {
+        float second_values[Environnement::MAX_DIMS];
+        for (int i = 0; i < neigh_count; i += 2) {
+            long long upwind = workspace.get_value(neighs[i]) <= workspace.get_value(neighs[i + 1]) ? neighs[i] : neighs[i + 1];
+            contributing_values[axis_count] = workspace.get_value(upwind);
+            second_values[axis_count] = second_upwind_value(neighbor, upwind, axis_count);
+            axis_count++;
+        }
+        return solve_eikonal_second_order(contributing_values, second_values, axis_count, cell_cost(neighbor));
+    }
+    for (int i = 0; i < neigh_count; i+=2)
     {
-        contributing_neighs.push_back(std::min(neighs[i],neighs[i+1],
-            [](Point* a, Point* b) { return a->get_value() < b->get_value(); }));
+        contributing_values[axis_count++] = std::min(workspace.get_value(neighs[i]), workspace.get_value(neighs[i+1]));
     }
-    return solve_eikonal(contributing_neighs);
+    return solve_eikonal(contributing_values, axis_count, cell_cost(neighbor));
+}
+
+float FMM::second_upwind_value(long long cell, long long upwind, int axis) const {
+    const float infinity = std::numeric_limits<float>::infinity();
+    if (upwind == cell || workspace.get_state(upwind) != FROZEN) return infinity;
+
+    // Voisins de upwind sur l'axe : cell et la cellule suivante ; au bord, get_neigh
+    // remplace la cellule manquante par cell, il n'y a alors pas de seconde cellule
+    long long neighs[Environnement::MAX_AXIS_NEIGHBORS];
+    env->get_neigh(upwind, neighs);
+    long long lower = neighs[2 * axis], upper = neighs[2 * axis + 1];
+    if ((lower == cell) == (upper == cell)) return infinity;
+    long long next = lower == cell ? upper : lower;
+
+    float value = workspace.get_value(next);
+    return workspace.get_state(next) == FROZEN && value <= workspace.get_value(upwind) ? value : infinity;
+}
+
+float FMM::solve_eikonal_second_order(float* first, float* second, int count, float cost) const {
+    // Tri par insertion sur first, second suit
+    for (int i = 1; i < count; i++) {
+        float value = first[i], next = second[i];
+        int j = i - 1;
+        for (; j >= 0 && first[j] > value; j--) {
+            first[j + 1] = first[j];
+            second[j + 1] = second[j];
+        }
+        first[j + 1] = value;
+        second[j + 1] = next;
+    }
+
+    if (count <= 0 || std::isinf(first[0])) return std::numeric_limits<float>::infinity();
+    const float base = first[0];
+
+    // Somme des w_i (t - d_i)² = c², d_i écart de la valeur effective de l'axe à base
+    float weights = 0.0f, sum = 0.0f, sum_of_squares = 0.0f;
+    float result = 0.0f;
+    for (int k = 0; k < count && (k == 0 || base + result > first[k]); k++) {
+        bool two_cells = !std::isinf(second[k]);
+        float weight = two_cells ? 2.25f : 1.0f;
+        float offset = two_cells ? (4.0f * first[k] - second[k]) / 3.0f - base : first[k] - base;
+        weights += weight;
+        sum += weight * offset;
+        sum_of_squares += weight * offset * offset;
+        float delta = sum * sum - weights * (sum_of_squares - cost * cost);
+        if (delta < 0.0f) return solve_eikonal(first, count, cost);
+        result = (sum + std::sqrt(delta)) / weights;
+    }
+    return base + result;
 }
 
 
@@ -63,37 +128,103 @@ float FMM::calculate_new_value(const Point* current, const Point* neighbor) {
 // }
 
 
-float FMM::solve_eikonal(const std::vector<Point*>& contributing_neighs) {
-
-    float a = static_cast<float>(contributing_neighs.size());
-
-    // Calculate the sum of U_value
-    float sum = std::accumulate(contributing_neighs.begin(), contributing_neighs.end(), 0.0f,
-        [](float total, Point* point) {
-            return total + point->get_value();
-        });
-
-    float b = -2 * sum;
-
-    // Calculate the sum of squares of U_value
-    float sum_of_squares = std::accumulate(contributing_neighs.begin(), contributing_neighs.end(), 0.0f,
-        [](float total, Point* point) {
-            float value = point->get_value();
-            return total + value * value;
-        });
-
-    float c = sum_of_squares - cost_per_unit_distance * cost_per_unit_distance;
+float FMM::local_update(const float* values, long long index) {
+    long long neighs[Environnement::MAX_AXIS_NEIGHBORS];
+    float contributing_values[Environnement::MAX_DIMS];
+    int neigh_count = env->get_neigh(index, neighs);
+    int axis_count = 0;
+    for (int i = 0; i < neigh_count; i += 2) {
+        contributing_values[axis_count++] = std::min(values[neighs[i]], values[neighs[i + 1]]);
+    }
+    return solve_eikonal(contributing_values, axis_count, cell_cost(index));
+}
 
+void FMM::init_field(std::vector<float>& values, std::vector<std::uint8_t>& fixed) const {
+    const long long total = env->get_shape().get_total();
+    values.assign(total, std::numeric_limits<float>::infinity());
+    fixed.assign(total, 0);
+    for (long long index = 0; index < total; index++) {
+        fixed[index] = !env->has_index(index) || env->is_obstacle(index);
+    }
+    for (const auto& seed : seed_cells(starts)) {
+        if (!env->has_index(seed.first) || env->is_obstacle(seed.first)) continue;
+        values[seed.first] = std::min(values[seed.first], seed.second);
+        fixed[seed.first] = 1;
+    }
+}
 
-    float delta = b * b - 4 * a * c;
+void FMM::store_field(const std::vector<float>& values) {
+    long long neighbors[Environnement::MAX_AXIS_NEIGHBORS];
+    for (long long index = 0; index < static_cast<long long>(values.size()); index++) {
+        if (std::isinf(values[index])) continue;
+        workspace.set_value(index, values[index]);
+        workspace.set_state(index, FROZEN);
+        long long parent = -1;
+        float best = values[index];
+        int count = env->get_neigh(index, neighbors);
+        for (int k = 0; k < count; k++) {
+            if (values[neighbors[k]] < best) {
+                best = values[neighbors[k]];
+                parent = neighbors[k];
+            }
+        }
+        if (parent >= 0) workspace.set_parent(index, parent);
+    }
+}
 
-    if (delta >= 0 && !std::isinf(delta)) {
-        float result = (-b + std::sqrt(delta)) / (2 * a);
-        return result;
-    } else {
-        float min_value = (*std::min_element(contributing_neighs.begin(), contributing_neighs.end(),
-            [](Point* a, Point* b) { return a->get_value() < b->get_value(); }))->get_value();
-        float result = min_value + cost_per_unit_distance;
-        return result;
+bool FMM::run_fixed_dimension_loop() {
+    const float* costs = env->get_cost_data();
+    if (stencil_order == SECOND_ORDER) {
+        auto update = [this, costs](const auto& grid, long long, long long neighbor, const auto& neighbor_coords) {
+            constexpr int N = std::decay_t<decltype(grid)>::DIM;
+            const float infinity = std::numeric_limits<float>::infinity();
+            float first[N], second[N];
+            for (int axis = 0; axis < N; axis++) {
+                // Même choix que calculate_new_value : côté inférieur en cas d'égalité, côté existant au bord
+                long long lower = grid.neighbor(neighbor, neighbor_coords, axis, -1);
+                long long upper = grid.neighbor(neighbor, neighbor_coords, axis, +1);
+                long long upwind = lower;
+                int direction = -1;
+                if (lower < 0 || (upper >= 0 && workspace.get_value(upper) < workspace.get_value(lower))) {
+                    upwind = upper;
+                    direction = 1;
+                }
+                if (upwind < 0) {
+                    first[axis] = workspace.get_value(neighbor);
+                    second[axis] = infinity;
+                    continue;
+                }
+                first[axis] = workspace.get_value(upwind);
+                second[axis] = infinity;
+                if (workspace.get_state(upwind) != FROZEN) continue;
+
+                auto upwind_coords = neighbor_coords;
+                upwind_coords[axis] += direction;
+                if (upwind_coords[axis] < 0) upwind_coords[axis] = grid.size(axis) - 1;
+                if (upwind_coords[axis] >= grid.size(axis)) upwind_coords[axis] = 0;
+                long long next = grid.neighbor(upwind, upwind_coords, axis, direction);
+                if (next >= 0 && next != neighbor && workspace.get_state(next) == FROZEN &&
+                    workspace.get_value(next) <= first[axis]) {
+                    second[axis] = workspace.get_value(next);
+                }
+            }
+            return solve_eikonal_second_order(first, second, N, costs ? cost_per_unit_distance * costs[neighbor] : cost_per_unit_distance);
+        };
+        return run_fixed_dimension(update);
     }
-}
\ No newline at end of file
+
+    auto update = [this, costs](const auto& grid, long long, long long neighbor, const auto& neighbor_coords) {
+        constexpr int N = std::decay_t<decltype(grid)>::DIM;
+        std::array<float, N> contributing_values;
+        for (int axis = 0; axis < N; axis++) {
+            // Au bord, même convention que get_neigh : voisin opposé, ou la cellule elle-même
+            long long lower = grid.neighbor(neighbor, neighbor_coords, axis, -1);
+            long long upper = grid.neighbor(neighbor, neighbor_coords, axis, +1);
+            if (lower < 0) lower = upper >= 0 ? upper : neighbor;
+            if (upper < 0) upper = lower;
+            contributing_values[axis] = std::min(workspace.get_value(lower), workspace.get_value(upper));
+        }
+        return solve_eikonal<N>(contributing_values, costs ? cost_per_unit_distance * costs[neighbor] : cost_per_unit_distance);
+    };
+    return run_fixed_dimension(update);
+}
@@ -0,0 +1,149 @@
+#include "algorithms/graph/FastIterativeMethod.hpp"
+#include "utils/Parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+FastIterativeMethod::FastIterativeMethod(Environnement* environment, float cost)
+    : FMM(environment, cost), thread_count(0), tolerance(1e-5f), iterations(0), peak_active(0) {}
+
+void FastIterativeMethod::set_thread_count(int threads)
+{
+    if (threads < 0) {
+        throw std::invalid_argument("FastIterativeMethod::set_thread_count: thread count must be >= 0.");
+    }
+    thread_count = threads;
+}
+
+void FastIterativeMethod::set_tolerance(float min_decrease)
+{
+    if (!(min_decrease >= 0.0f)) {
+        throw std::invalid_argument("FastIterativeMethod::set_tolerance: tolerance must be >= 0.");
+    }
+    tolerance = min_decrease;
+}
+
+bool FastIterativeMethod::decreases(float old_value, float new_value) const
+{
+    // Une cellule atteinte pour la première fois (INFINITY) baisse toujours
+    return new_value < old_value &&
+           (std::isinf(old_value) || old_value - new_value > tolerance * std::max(1.0f, new_value));
+}
+
+void FastIterativeMethod::process_batch(const std::vector<float>& values, const std::vector<std::uint8_t>& blocked,
+                                        const std::vector<long long>& active, long long begin, long long end,
+                                        std::vector<float>& updated, std::vector<std::uint8_t>& converged,
+                                        std::vector<std::pair<long long, float>>& candidates, long long& updates)
+{
+    long long neighbors[Environnement::MAX_AXIS_NEIGHBORS];
+    for (long long k = begin; k < end; k++) {
+        const long long index = active[k];
+        const float old_value = values[index];
+        const float new_value = local_update(values.data(), index);
+        updates++;
+        if (decreases(old_value, new_value)) {
+            updated[k] = new_value;
+            converged[k] = 0;
+            continue;
+        }
+        updated[k] = std::min(old_value, new_value);
+        converged[k] = 1;
+
+        // Voisins dont la valeur baisse grâce à cette cellule (le bord de get_neigh renvoie
+        // la cellule elle-même ou un doublon : filtrés par blocked et par la fusion)
+        int count = env->get_neigh(index, neighbors);
+        for (int n = 0; n < count; n++) {
+            const long long neighbor = neighbors[n];
+            if (blocked[neighbor]) continue;
+            float value = local_update(values.data(), neighbor);
+            updates++;
+            if (decreases(values[neighbor], value)) candidates.emplace_back(neighbor, value);
+        }
+    }
+}
+
+void FastIterativeMethod::execute()
+{
+    if (get_stencil_order() != FIRST_ORDER) {
+        throw std::logic_error("FastIterativeMethod::execute: only FIRST_ORDER stencils are supported.");
+    }
+    if (starts.empty()) {
+        std::cerr << "Aucun point de départ défini!" << std::endl;
+        return;
+    }
+
+    reset_environment();
+    iterations = 0;
+    peak_active = 0;
+
+    std::vector<float> values;
+    std::vector<std::uint8_t> blocked;
+    init_field(values, blocked);
+
+    // Liste initiale : voisins libres des départs
+    std::vector<long long> active;
+    long long neighbors[Environnement::MAX_AXIS_NEIGHBORS];
+    for (const auto& seed : seed_cells(starts)) {
+        if (!env->has_index(seed.first) || env->is_obstacle(seed.first)) continue;
+        int count = env->get_neigh(seed.first, neighbors);
+        for (int n = 0; n < count; n++) {
+            if (blocked[neighbors[n]]) continue;
+            blocked[neighbors[n]] = 1;
+            active.push_back(neighbors[n]);
+            stats.pushes++;
+        }
+    }
+
+    std::vector<float> updated;
+    std::vector<std::uint8_t> converged;
+    std::vector<std::vector<std::pair<long long, float>>> candidates;
+    std::vector<long long> updates;
+    std::vector<long long> next;
+
+    while (!active.empty()) {
+        const long long size = static_cast<long long>(active.size());
+        peak_active = std::max(peak_active, size);
+        const long long batches = std::max(1LL, size / MIN_CELLS_PER_THREAD);
+        const int threads = resolve_thread_count(thread_count, static_cast<int>(std::min<long long>(batches, 256)));
+        updated.resize(size);
+        converged.resize(size);
+        candidates.resize(threads);
+        updates.assign(threads, 0);
+
+        // Lots contigus de la liste, lus sur le champ de l'itération précédente
+        run_threads(threads, [&](int t) {
+            candidates[t].clear();
+            process_batch(values, blocked, active, size * t / threads, size * (t + 1) / threads,
+                          updated, converged, candidates[t], updates[t]);
+        });
+
+        // Fusion séquentielle, dans l'ordre de la liste : indépendante du nombre de threads
+        next.clear();
+        for (long long k = 0; k < size; k++) {
+            values[active[k]] = updated[k];
+            if (converged[k]) blocked[active[k]] = 0;
+            else next.push_back(active[k]);
+        }
+        for (int t = 0; t < threads; t++) {
+            stats.expansions += updates[t];
+            for (const auto& candidate : candidates[t]) {
+                if (candidate.second >= values[candidate.first]) continue;
+                values[candidate.first] = candidate.second;
+                if (blocked[candidate.first]) continue;
+                blocked[candidate.first] = 1;
+                next.push_back(candidate.first);
+                stats.pushes++;
+            }
+        }
+        active.swap(next);
+        iterations++;
+    }
+
+    store_field(values);
+
+    if (verbose) {
+        std::cout << "FIM terminé. Itérations: " << iterations << ", liste active max: " << peak_active
+                  << ", mises à jour: " << stats.expansions << std::endl;
+    }
+}
@@ -0,0 +1,215 @@
+#include "algorithms/graph/FastSweeping.hpp"
+#include "utils/Parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+FastSweeping::FastSweeping(Environnement* environment, float cost)
+    : FMM(environment, cost), parallel(false), thread_count(0), tolerance(1e-5f), max_iterations(1000),
+      iterations(0), converged(false) {}
+
+void FastSweeping::set_parallel(bool enabled, int threads)
+{
+    if (threads < 0) {
+        throw std::invalid_argument("FastSweeping::set_parallel: thread count must be >= 0.");
+    }
+    parallel = enabled;
+    thread_count = threads;
+}
+
+void FastSweeping::set_convergence(float min_decrease, int rounds)
+{
+    if (!(min_decrease >= 0.0f) || rounds <= 0) {
+        throw std::invalid_argument("FastSweeping::set_convergence: tolerance must be >= 0 and rounds > 0.");
+    }
+    tolerance = min_decrease;
+    max_iterations = rounds;
+}
+
+float FastSweeping::sweep(float* values, const std::vector<std::uint8_t>& fixed, int ordering, long long& updates)
+{
+    if (fixed_dimension_kernels && env->get_backend() == Environnement::DENSE) {
+        switch (env->get_shape().get_dim()) {
+            case 2: return sweep_fixed(FixedGrid<2>(*env), values, fixed, ordering, updates);
+            case 3: return sweep_fixed(FixedGrid<3>(*env), values, fixed, ordering, updates);
+            default: break;
+        }
+    }
+
+    const GridShape& shape = env->get_shape();
+    const int dim = shape.get_dim();
+    int coords[Environnement::MAX_DIMS];
+    for (int i = 0; i < dim; i++) coords[i] = ((ordering >> i) & 1) ? shape.size(i) - 1 : 0;
+
+    float max_decrease = 0.0f;
+    const long long total = shape.get_total();
+    for (long long n = 0; n < total; n++) {
+        long long index = 0;
+        for (int i = 0; i < dim; i++) index += coords[i] * shape.stride(i);
+
+        if (!fixed[index]) {
+            float new_value = local_update(values, index);
+            updates++;
+            if (new_value < values[index]) {
+                // Baisse relative ; INFINITY si la cellule vient d'être atteinte
+                float decrease = (values[index] - new_value) / std::max(1.0f, new_value);
+                values[index] = new_value;
+                if (decrease > max_decrease) max_decrease = decrease;
+            }
+        }
+
+        // Cellule suivante : dernier axe (pas 1) le plus rapide, chaque axe dans son sens
+        for (int i = dim - 1; i >= 0; i--) {
+            if ((ordering >> i) & 1) {
+                if (coords[i] > 0) { coords[i]--; break; }
+                coords[i] = shape.size(i) - 1;
+            } else {
+                if (coords[i] < shape.size(i) - 1) { coords[i]++; break; }
+                coords[i] = 0;
+            }
+        }
+    }
+    return max_decrease;
+}
+
+template <int N>
+float FastSweeping::sweep_fixed(const FixedGrid<N>& grid, float* values, const std::vector<std::uint8_t>& fixed,
+                                int ordering, long long& updates)
+{
+    const GridShape& shape = env->get_shape();
+    const float* costs = env->get_cost_data();
+    const float cost = get_cost_per_unit_distance();
+    typename FixedGrid<N>::Coords c;
+    std::array<long long, N> strides;
+    for (int i = 0; i < N; i++) {
+        c[i] = ((ordering >> i) & 1) ? grid.size(i) - 1 : 0;
+        strides[i] = shape.stride(i);
+    }
+
+    float max_decrease = 0.0f;
+    const long long total = shape.get_total();
+    for (long long n = 0; n < total; n++) {
+        long long index = 0;
+        for (int i = 0; i < N; i++) index += c[i] * strides[i];
+
+        if (!fixed[index]) {
+            // Même convention que get_neigh au bord : voisin opposé, ou la cellule elle-même
+            float contributing_values[N];
+            for (int axis = 0; axis < N; axis++) {
+                long long lower = grid.neighbor(index, c, axis, -1);
+                long long upper = grid.neighbor(index, c, axis, +1);
+                if (lower < 0) lower = upper >= 0 ? upper : index;
+                if (upper < 0) upper = lower;
+                contributing_values[axis] = std::min(values[lower], values[upper]);
+            }
+            float new_value = solve_eikonal(contributing_values, N, costs ? cost * costs[index] : cost);
+            updates++;
+            if (new_value < values[index]) {
+                float decrease = (values[index] - new_value) / std::max(1.0f, new_value);
+                values[index] = new_value;
+                if (decrease > max_decrease) max_decrease = decrease;
+            }
+        }
+
+        for (int i = N - 1; i >= 0; i--) {
+            if ((ordering >> i) & 1) {
+                if (c[i] > 0) { c[i]--; break; }
+                c[i] = grid.size(i) - 1;
+            } else {
+                if (c[i] < grid.size(i) - 1) { c[i]++; break; }
+                c[i] = 0;
+            }
+        }
+    }
+    return max_decrease;
+}
+
+void FastSweeping::run_sequential(std::vector<float>& values, const std::vector<std::uint8_t>& fixed)
+{
+    const int orderings = 1 << env->get_shape().get_dim();
+    while (iterations < max_iterations) {
+        float max_decrease = 0.0f;
+        for (int ordering = 0; ordering < orderings; ordering++) {
+            max_decrease = std::max(max_decrease, sweep(values.data(), fixed, ordering, stats.expansions));
+        }
+        iterations++;
+        if (max_decrease <= tolerance) {
+            converged = true;
+            return;
+        }
+    }
+}
+
+void FastSweeping::run_parallel(std::vector<float>& values, const std::vector<std::uint8_t>& fixed)
+{
+    const int orderings = 1 << env->get_shape().get_dim();
+    const int threads = resolve_thread_count(thread_count, orderings);
+
+    std::vector<std::vector<float>> copies(orderings);
+    std::vector<float> decreases(orderings);
+    std::vector<long long> updates(orderings);
+    const long long total = static_cast<long long>(values.size());
+
+    while (iterations < max_iterations) {
+        // Chaque ordre balaie sa copie du champ courant
+        run_threads(threads, [&](int t) {
+            for (int ordering = t; ordering < orderings; ordering += threads) {
+                copies[ordering] = values;
+                updates[ordering] = 0;
+                decreases[ordering] = sweep(copies[ordering].data(), fixed, ordering, updates[ordering]);
+            }
+        });
+
+        // Minimum des copies, par tranches de cellules
+        run_threads(threads, [&](int t) {
+            long long begin = total * t / threads, end = total * (t + 1) / threads;
+            for (const auto& copy : copies) {
+                for (long long index = begin; index < end; index++) {
+                    if (copy[index] < values[index]) values[index] = copy[index];
+                }
+            }
+        });
+
+        float max_decrease = 0.0f;
+        for (int ordering = 0; ordering < orderings; ordering++) {
+            max_decrease = std::max(max_decrease, decreases[ordering]);
+            stats.expansions += updates[ordering];
+        }
+        iterations++;
+        if (max_decrease <= tolerance) {
+            converged = true;
+            return;
+        }
+    }
+}
+
+void FastSweeping::execute()
+{
+    if (get_stencil_order() != FIRST_ORDER) {
+        throw std::logic_error("FastSweeping::execute: only FIRST_ORDER stencils are supported.");
+    }
+    if (starts.empty()) {
+        std::cerr << "Aucun point de départ défini!" << std::endl;
+        return;
+    }
+
+    reset_environment();
+    iterations = 0;
+    converged = false;
+
+    std::vector<float> values;
+    std::vector<std::uint8_t> fixed;
+    init_field(values, fixed);
+
+    if (parallel) run_parallel(values, fixed);
+    else run_sequential(values, fixed);
+
+    store_field(values);
+
+    if (verbose) {
+        std::cout << "Fast Sweeping terminé. Tours: " << iterations << (converged ? "" : " (non convergé)")
+                  << ", mises à jour: " << stats.expansions << std::endl;
+    }
+}
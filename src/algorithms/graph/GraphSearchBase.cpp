@@ -5,7 +5,35 @@
 #include <stb/stb_image_write.h>
 
 GraphSearchBase::GraphSearchBase(Environnement* environment) 
-    : env(environment), processed_count(0) {}
+    : env(environment), neighborhood(nullptr), queue_policy(DARY_HEAP), front_bucket_width(0.0f),
+      fixed_dimension_kernels(true), verbose(true) {}
+
+void GraphSearchBase::set_neighborhood(NeighborhoodStrategy* neighbors) {
+    neighborhood = neighbors;
+    if (neighborhood && env) {
+        neighborhood->set_environment(env);
+    }
+}
+
+void GraphSearchBase::set_queue_policy(QueuePolicy policy) {
+    if (policy != queue_policy) {
+        queue_policy = policy;
+        front.reset(); // Recréée par reset_environment
+    }
+}
+
+bool GraphSearchBase::run_fixed_dimension_loop() {
+    return false;
+}
+
+float GraphSearchBase::get_priority(long long index, float value) const {
+    (void)index;
+    return value;
+}
+
+float GraphSearchBase::get_bucket_width() const {
+    return 1.0f;
+}
 
 void GraphSearchBase::add_start(const std::vector<float>& coords) {
     starts.push_back(coords);
@@ -24,16 +52,32 @@ void GraphSearchBase::clear_ends() {
 }
 
 void GraphSearchBase::reset_environment() {
-    auto& point_map = env->get_map_ref();
-    for (auto& pair : point_map) {
-        Point& point = pair.second;
-        if (!point.get_obs()) { // Ne pas toucher aux obstacles
-            point.set_state(FAR);
-            point.set_value(INFINITY);
-            point.set_parent(nullptr);
-        }
+    // L'environnement n'est pas modifié : seul l'espace de travail de la requête est réinitialisé
+    long long total_points = env->get_shape().get_total();
+    // Voisinage partagé : re-préparé pour cette carte (sans coût si les dimensions sont inchangées)
+    if (neighborhood) neighborhood->set_environment(env);
+    if (workspace.size() != total_points) {
+        workspace.resize(total_points);
+    } else {
+        workspace.reset();
+    }
+
+    // La file n'est recréée que si la politique, la taille ou la largeur des seaux change
+    bool bucketed = queue_policy == DIAL_BUCKETS || queue_policy == UNTIDY_BUCKETS;
+    float bucket_width = bucketed ? get_bucket_width() : 0.0f;
+    if (!front || front->capacity() != total_points || bucket_width != front_bucket_width) {
+        front = FrontQueue::create(queue_policy, bucket_width);
+        front->resize(total_points);
+        front_bucket_width = bucket_width;
+    } else {
+        front->clear();
     }
-    processed_count = 0;
+    stats = SearchStatistics();
+}
+
+float GraphSearchBase::get_value(const std::vector<float>& coords) const {
+    long long index = env->index_of(coords);
+    return (index >= 0 && index < workspace.size()) ? workspace.get_value(index) : INFINITY;
 }
 
 void GraphSearchBase::execute()
@@ -45,37 +89,39 @@ void GraphSearchBase::execute()
     
     reset_environment();
     
-    // Vider la queue
-    while (!front.empty()) front.pop();
-    
     // Initialiser les points de départ
     initialize_starts();
     
-    // Boucle principale de l'algorithme (Template Method Pattern)
-    while (should_continue()) {
-        Point* current = front.top();
-        front.pop();
-        
-        // Passer ce point à l'état FROZEN
-        current->set_state(FROZEN);
-        processed_count++;
-        
-        // Traiter ce point (appel méthode virtuelle)
-        process_point(current);
+    // Boucle spécialisée (2D / 3D) si l'algorithme en fournit une
+    if (!run_fixed_dimension_loop()) {
+        // Boucle principale de l'algorithme (Template Method Pattern)
+        while (should_continue()) {
+            long long current = front->pop().index;
+            stats.pops++;
+            
+            // Passer ce point à l'état FROZEN
+            workspace.set_state(current, FROZEN);
+            stats.expansions++;
+            
+            // Traiter ce point (appel méthode virtuelle)
+            process_point(current);
+        }
     }
     
-    std::cout << "Algorithme terminé. Points traités: " << processed_count << std::endl;
+    if (verbose) {
+        std::cout << "Algorithme terminé. Points traités: " << stats.expansions << std::endl;
+    }
 }
 
 void GraphSearchBase::initialize_starts()
 {
     for (const auto& start_coords : starts) {
-        if (env->hasPoint(start_coords)) {
-            Point& start_point = env->getPoint(start_coords);
-            if (!start_point.get_obs()) {
-                start_point.set_value(0.0f);
-                start_point.set_state(FRONT);
-                front.push(&start_point);
+        long long start_index = env->index_of(start_coords);
+        if (start_index >= 0) {
+            if (!env->is_obstacle(start_index)) {
+                workspace.set_value(start_index, 0.0f);
+                workspace.set_state(start_index, FRONT);
+                push_front(start_index, get_priority(start_index, 0.0f));
             }
         }
         else if(env->is_in_bounds(start_coords))
@@ -91,51 +137,111 @@ void GraphSearchBase::initialize_floating_start(const std::vector<float>& coords
 
     for (auto corner : corners)
     {
-        if(!corner.first->get_obs())
+        if(!env->is_obstacle(corner.first))
         {
-            corner.first->set_value(corner.second);
-            corner.first->set_state(FRONT);
-            front.push(corner.first);
+            workspace.set_value(corner.first, corner.second);
+            workspace.set_state(corner.first, FRONT);
+            push_front(corner.first, get_priority(corner.first, corner.second));
         }
     }
 
 }
 
+std::vector<std::pair<long long, float>> GraphSearchBase::seed_cells(const std::vector<std::vector<float>>& points) const
+{
+    std::vector<std::pair<long long, float>> seeds;
+    for (const auto& coords : points) {
+        long long index = env->index_of(coords);
+        if (index >= 0) {
+            seeds.push_back({index, 0.0f});
+        } else if (env->is_in_bounds(coords)) {
+            for (const auto& corner : env->get_hypercube_corners_with_weights(coords)) {
+                seeds.push_back(corner);
+            }
+        }
+    }
+    return seeds;
+}
+
 bool GraphSearchBase::should_continue() const {
-    return !front.empty();
+    return !front->empty();
 }
 
-void GraphSearchBase::process_point(Point* current)
+void GraphSearchBase::process_point(long long current)
 {
-    // Examiner tous les voisins
-    std::vector<Point*> neighbors = env->get_neigh(*current);
+    for_each_neighbor(current, [&](long long neighbor, float step_length) {
+        relax_neighbor(current, neighbor, step_length);
+    });
+}
+
+void GraphSearchBase::relax_neighbor(long long current, long long neighbor, float step_length)
+{
+    // Vérifier si ce voisin doit être mis à jour
+    if (!should_update_neighbor(neighbor)) {
+        return;
+    }
     
-    for (Point* neighbor : neighbors) {
-        // Vérifier si ce voisin doit être mis à jour
-        if (!should_update_neighbor(neighbor)) {
-            continue;
-        }
-        
-        // Calculer la nouvelle valeur (appel méthode virtuelle pure)
-        float new_value = calculate_new_value(current, neighbor);
-        
-        // Si c'est un nouveau point ou si on a trouvé un chemin plus court
-        if (neighbor->get_state() == FAR || new_value < neighbor->get_value()) {
-            update_neighbor(neighbor, new_value, current);
-        }
+    // Calculer la nouvelle valeur (appel méthode virtuelle pure)
+    float new_value = calculate_new_value(current, neighbor, step_length);
+    
+    // Si c'est un nouveau point ou si on a trouvé un chemin plus court
+    if (workspace.get_state(neighbor) == FAR || new_value < workspace.get_value(neighbor)) {
+        update_neighbor(neighbor, new_value, current);
     }
 }
 
-bool GraphSearchBase::should_update_neighbor(const Point* neighbor) const {
+bool GraphSearchBase::should_update_neighbor(long long neighbor) const {
     // Ignorer les obstacles et les points déjà traités
-    return !neighbor->get_obs() && neighbor->get_state() != FROZEN;
+    return !env->is_obstacle(neighbor) && workspace.get_state(neighbor) != FROZEN;
+}
+
+void GraphSearchBase::update_neighbor(long long neighbor, float new_value, long long parent) {
+    workspace.set_value(neighbor, new_value);
+    workspace.set_parent(neighbor, parent);
+    workspace.set_state(neighbor, FRONT);
+    push_front(neighbor, get_priority(neighbor, new_value));
+}
+
+void GraphSearchBase::push_front(long long index, float key) {
+    if (front->push(index, key)) {
+        stats.pushes++;
+    } else {
+        stats.decrease_keys++;
+    }
 }
 
-void GraphSearchBase::update_neighbor(Point* neighbor, float new_value, Point* parent) {
-    neighbor->set_value(new_value);
-    neighbor->set_parent(parent);
-    neighbor->set_state(FRONT);
-    front.push(neighbor);
+float GraphSearchBase::get_interpolated_value(const std::vector<float>& coords) const {
+    auto corners = env->get_hypercube_corners_with_weights(coords);
+
+    if (corners.empty()) {
+        return std::numeric_limits<float>::infinity();
+    }
+
+    float interpolated_value = 0.0f;
+    float total_weight = 0.0f;
+
+    for (const auto& corner : corners) {
+        interpolated_value += corner.second * workspace.get_value(corner.first);
+        total_weight += corner.second;
+    }
+
+    return (total_weight > 0) ? interpolated_value / total_weight : std::numeric_limits<float>::infinity();
+}
+
+bool GraphSearchBase::are_all_corners_frozen(const std::vector<float>& coords) const {
+    auto corners = env->get_hypercube_corners_with_weights(coords);
+
+    if (corners.empty()) {
+        return false;
+    }
+
+    for (const auto& corner : corners) {
+        if (workspace.get_state(corner.first) != FROZEN) {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 void GraphSearchBase::display_U_values_grid() const {
@@ -166,15 +272,17 @@ void GraphSearchBase::display_U_values_grid() const {
         for (int x = 0; x < width; x++) {
             std::vector<float> coords = {static_cast<float>(x), static_cast<float>(y)};
             
-            if (env->hasPoint(coords)) {
-                const Point& point = env->getPoint(coords);
+            long long index = env->index_of(coords);
+            if (index >= 0) {
+                bool obs = env->is_obstacle(index);
+                float value = index < workspace.size() ? workspace.get_value(index) : INFINITY;
                 
-                if (point.get_obs()) {
+                if (obs) {
                     std::cout << "###";
-                } else if (point.get_value() == INFINITY) {
+                } else if (value == INFINITY) {
                     std::cout << " ∞ ";
                 } else {
-                    std::cout << std::setw(3) << static_cast<int>(point.get_value());
+                    std::cout << std::setw(3) << static_cast<int>(value);
                 }
             } else {
                 std::cout << " ? ";
@@ -200,10 +308,12 @@ void GraphSearchBase::save_U_values_image(const std::string& filename) const {
     for (int y = 0; y < height; y++) {
         for (int x = 0; x < width; x++) {
             std::vector<float> coords = {static_cast<float>(x), static_cast<float>(y)};
-            if (env->hasPoint(coords)) {
-                const Point& point = env->getPoint(coords);
-                if (!point.get_obs() && point.get_value() != INFINITY) {
-                    max_value = std::max(max_value, point.get_value());
+            long long index = env->index_of(coords);
+            if (index >= 0) {
+                bool obs = env->is_obstacle(index);
+                float value = index < workspace.size() ? workspace.get_value(index) : INFINITY;
+                if (!obs && value != INFINITY) {
+                    max_value = std::max(max_value, value);
                 }
             }
         }
@@ -217,22 +327,24 @@ void GraphSearchBase::save_U_values_image(const std::string& filename) const {
             int pixel_index = (y * width + x) * 3;
             std::vector<float> coords = {static_cast<float>(x), static_cast<float>(y)};
             
-            if (env->hasPoint(coords)) {
-                const Point& point = env->getPoint(coords);
+            long long index = env->index_of(coords);
+            if (index >= 0) {
+                bool obs = env->is_obstacle(index);
+                float value = index < workspace.size() ? workspace.get_value(index) : INFINITY;
                 
-                if (point.get_obs()) {
+                if (obs) {
                     // Obstacle = noir
                     image[pixel_index] = 0;
                     image[pixel_index + 1] = 0;
                     image[pixel_index + 2] = 0;
-                } else if (point.get_value() == INFINITY) {
+                } else if (value == INFINITY) {
                     // Non atteint = gris foncé
                     image[pixel_index] = 50;
                     image[pixel_index + 1] = 50;
                     image[pixel_index + 2] = 50;
                 } else {
                     // Gradient de couleur basé sur la distance
-                    float normalized = (max_value > 0) ? point.get_value() / max_value : 0.0f;
+                    float normalized = (max_value > 0) ? value / max_value : 0.0f;
                     
                     // Palette bleu -> vert -> jaune -> rouge
                     if (normalized < 0.33f) {
@@ -0,0 +1,466 @@
+#include "algorithms/graph/HPAStar.hpp"
+#include "utils/FrontQueue.hpp"
+#include "utils/PathExtractor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+// =====================================================================
+// Recherche locale
+// =====================================================================
+
+ClusterAbstraction::LocalSearch::LocalSearch(const Environnement& environment, const std::vector<int>& box_lower,
+                                             const std::vector<int>& box_upper, float edge_cost)
+    : env(&environment), lower(box_lower), upper(box_upper)
+{
+    std::vector<int> local_dims(lower.size());
+    for (size_t axis = 0; axis < lower.size(); axis++) local_dims[axis] = upper[axis] - lower[axis];
+
+    local = std::make_unique<Environnement>(Environnement::DENSE);
+    local->set_dims(local_dims);
+    for (long long index = 0; index < local->get_shape().get_total(); index++) {
+        long long cell = to_global(index);
+        local->set_obs(index, !env->has_index(cell) || env->is_obstacle(cell));
+    }
+
+    dijkstra = std::make_unique<Dijkstra>(local.get(), edge_cost);
+    dijkstra->set_verbose(false);
+}
+
+long long ClusterAbstraction::LocalSearch::to_local(long long cell) const
+{
+    const GridShape& shape = env->get_shape();
+    const GridShape& local_shape = local->get_shape();
+    long long index = 0;
+    for (int axis = 0; axis < shape.get_dim(); axis++) {
+        int c = shape.coord(cell, axis);
+        if (c < lower[axis] || c >= upper[axis]) return -1;
+        index += (c - lower[axis]) * local_shape.stride(axis);
+    }
+    return index;
+}
+
+long long ClusterAbstraction::LocalSearch::to_global(long long local_index) const
+{
+    const GridShape& shape = env->get_shape();
+    const GridShape& local_shape = local->get_shape();
+    long long cell = 0;
+    for (int axis = 0; axis < shape.get_dim(); axis++) {
+        cell += (lower[axis] + local_shape.coord(local_index, axis)) * shape.stride(axis);
+    }
+    return cell;
+}
+
+void ClusterAbstraction::LocalSearch::run(long long source)
+{
+    long long local_source = to_local(source);
+    if (local_source < 0) {
+        throw std::invalid_argument("ClusterAbstraction::LocalSearch: source outside of the box.");
+    }
+    dijkstra->clear_starts();
+    dijkstra->add_start(local->cell(local_source).get_coords());
+    dijkstra->execute();
+}
+
+float ClusterAbstraction::LocalSearch::distance(long long cell) const
+{
+    long long local_index = to_local(cell);
+    if (local_index < 0) return std::numeric_limits<float>::infinity();
+    return dijkstra->get_workspace().get_value(local_index);
+}
+
+std::vector<long long> ClusterAbstraction::LocalSearch::path_to(long long cell) const
+{
+    long long local_index = to_local(cell);
+    if (local_index < 0 || std::isinf(dijkstra->get_workspace().get_value(local_index))) return {};
+    std::vector<long long> local_path = PathExtractor::extractPath(dijkstra->get_workspace(), local_index);
+    for (long long& index : local_path) index = to_global(index);
+    return local_path;
+}
+
+// =====================================================================
+// Abstraction
+// =====================================================================
+
+ClusterAbstraction::ClusterAbstraction(const Environnement* environment, int size, float cost)
+    : env(environment), cluster_size(size), edge_cost(cost), preprocessing_expansions(0)
+{
+    if (!env) {
+        throw std::invalid_argument("ClusterAbstraction: environment cannot be nullptr.");
+    }
+    if (size < 1) {
+        throw std::invalid_argument("ClusterAbstraction: cluster size must be >= 1.");
+    }
+    const GridShape& shape = env->get_shape();
+    std::vector<int> counts(shape.get_dim());
+    for (int axis = 0; axis < shape.get_dim(); axis++) {
+        if (env->is_periodic(axis)) {
+            throw std::invalid_argument("ClusterAbstraction: periodic environments are not supported.");
+        }
+        counts[axis] = (shape.size(axis) + size - 1) / size;
+    }
+    cluster_shape = GridShape(counts);
+}
+
+bool ClusterAbstraction::is_free(long long cell) const
+{
+    return env->has_index(cell) && !env->is_obstacle(cell);
+}
+
+long long ClusterAbstraction::cluster_of(long long cell) const
+{
+    const GridShape& shape = env->get_shape();
+    long long cluster = 0;
+    for (int axis = 0; axis < shape.get_dim(); axis++) {
+        cluster += (shape.coord(cell, axis) / cluster_size) * cluster_shape.stride(axis);
+    }
+    return cluster;
+}
+
+void ClusterAbstraction::cluster_bounds(long long cluster, std::vector<int>& lower, std::vector<int>& upper) const
+{
+    const GridShape& shape = env->get_shape();
+    lower.resize(shape.get_dim());
+    upper.resize(shape.get_dim());
+    for (int axis = 0; axis < shape.get_dim(); axis++) {
+        lower[axis] = cluster_shape.coord(cluster, axis) * cluster_size;
+        upper[axis] = std::min(lower[axis] + cluster_size, shape.size(axis));
+    }
+}
+
+int ClusterAbstraction::node_of(long long cell) const
+{
+    auto it = node_of_cell.find(cell);
+    return it == node_of_cell.end() ? -1 : it->second;
+}
+
+void ClusterAbstraction::compute_face(long long cluster, int axis)
+{
+    const GridShape& shape = env->get_shape();
+    const int dim = shape.get_dim();
+    std::vector<std::pair<long long, long long>>& face_transitions = transitions[cluster * dim + axis];
+    face_transitions.clear();
+    if (cluster_shape.coord(cluster, axis) + 1 >= cluster_shape.size(axis)) return;
+
+    // Face : dernière tranche du cluster le long de l'axe, face à la première tranche du suivant
+    std::vector<int> lower, upper;
+    cluster_bounds(cluster, lower, upper);
+    std::vector<int> face_dims(dim);
+    for (int k = 0; k < dim; k++) face_dims[k] = (k == axis) ? 1 : upper[k] - lower[k];
+    GridShape face(face_dims);
+
+    std::vector<long long> cells(face.get_total());
+    std::vector<char> open(face.get_total(), 0);
+    for (long long f = 0; f < face.get_total(); f++) {
+        long long cell = 0;
+        for (int k = 0; k < dim; k++) {
+            int c = (k == axis) ? upper[axis] - 1 : lower[k] + face.coord(f, k);
+            cell += c * shape.stride(k);
+        }
+        cells[f] = cell;
+        open[f] = is_free(cell) && is_free(cell + shape.stride(axis));
+    }
+
+    // Composantes connexes de la face : une entrée chacune
+    std::vector<char> visited(face.get_total(), 0);
+    std::vector<long long> component, stack;
+    for (long long seed = 0; seed < face.get_total(); seed++) {
+        if (!open[seed] || visited[seed]) continue;
+        component.clear();
+        stack.assign(1, seed);
+        visited[seed] = 1;
+        while (!stack.empty()) {
+            long long f = stack.back();
+            stack.pop_back();
+            component.push_back(f);
+            for (int k = 0; k < dim; k++) {
+                if (k == axis) continue;
+                int c = face.coord(f, k);
+                if (c > 0 && open[f - face.stride(k)] && !visited[f - face.stride(k)]) {
+                    visited[f - face.stride(k)] = 1;
+                    stack.push_back(f - face.stride(k));
+                }
+                if (c + 1 < face_dims[k] && open[f + face.stride(k)] && !visited[f + face.stride(k)]) {
+                    visited[f + face.stride(k)] = 1;
+                    stack.push_back(f + face.stride(k));
+                }
+            }
+        }
+        std::sort(component.begin(), component.end());
+
+        std::vector<long long> chosen;
+        if (component.size() < static_cast<size_t>(LONG_ENTRANCE)) {
+            chosen.push_back(component[component.size() / 2]);
+        } else {
+            chosen.push_back(component.front());
+            chosen.push_back(component.back());
+        }
+        for (long long f : chosen) {
+            face_transitions.emplace_back(cells[f], cells[f] + shape.stride(axis));
+        }
+    }
+}
+
+void ClusterAbstraction::compute_cluster(long long cluster)
+{
+    const int dim = env->get_shape().get_dim();
+
+    // Entrées : extrémités des transitions des faces supérieures et inférieures
+    std::vector<long long>& cluster_entrances = entrances[cluster];
+    cluster_entrances.clear();
+    for (int axis = 0; axis < dim; axis++) {
+        for (const auto& transition : transitions[cluster * dim + axis]) {
+            cluster_entrances.push_back(transition.first);
+        }
+        if (cluster_shape.coord(cluster, axis) > 0) {
+            long long previous = cluster - cluster_shape.stride(axis);
+            for (const auto& transition : transitions[previous * dim + axis]) {
+                cluster_entrances.push_back(transition.second);
+            }
+        }
+    }
+    std::sort(cluster_entrances.begin(), cluster_entrances.end());
+    cluster_entrances.erase(std::unique(cluster_entrances.begin(), cluster_entrances.end()), cluster_entrances.end());
+
+    // Distances intra-cluster (symétriques)
+    size_t count = cluster_entrances.size();
+    std::vector<float>& matrix = intra_distances[cluster];
+    matrix.assign(count * count, std::numeric_limits<float>::infinity());
+    if (count < 2) {
+        if (count == 1) matrix[0] = 0.0f;
+        return;
+    }
+
+    std::vector<int> lower, upper;
+    cluster_bounds(cluster, lower, upper);
+    LocalSearch search(*env, lower, upper, edge_cost);
+    for (size_t i = 0; i < count; i++) {
+        matrix[i * count + i] = 0.0f;
+        if (i + 1 == count) break;
+        search.run(cluster_entrances[i]);
+        preprocessing_expansions += search.get_expansions();
+        for (size_t j = i + 1; j < count; j++) {
+            float distance = search.distance(cluster_entrances[j]);
+            matrix[i * count + j] = distance;
+            matrix[j * count + i] = distance;
+        }
+    }
+}
+
+void ClusterAbstraction::rebuild_graph()
+{
+    node_cells.clear();
+    node_of_cell.clear();
+    for (const auto& cluster_entrances : entrances) {
+        for (long long cell : cluster_entrances) {
+            node_of_cell.emplace(cell, static_cast<int>(node_cells.size()));
+            node_cells.push_back(cell);
+        }
+    }
+
+    edges.assign(node_cells.size(), {});
+    for (size_t cluster = 0; cluster < entrances.size(); cluster++) {
+        const std::vector<long long>& cluster_entrances = entrances[cluster];
+        size_t count = cluster_entrances.size();
+        for (size_t i = 0; i < count; i++) {
+            int from = node_of_cell[cluster_entrances[i]];
+            for (size_t j = 0; j < count; j++) {
+                float distance = intra_distances[cluster][i * count + j];
+                if (i != j && !std::isinf(distance)) {
+                    edges[from].push_back({node_of_cell[cluster_entrances[j]], distance});
+                }
+            }
+        }
+    }
+    for (const auto& face_transitions : transitions) {
+        for (const auto& transition : face_transitions) {
+            int a = node_of_cell[transition.first];
+            int b = node_of_cell[transition.second];
+            edges[a].push_back({b, edge_cost});
+            edges[b].push_back({a, edge_cost});
+        }
+    }
+}
+
+void ClusterAbstraction::build()
+{
+    const int dim = env->get_shape().get_dim();
+    long long cluster_count = cluster_shape.get_total();
+    transitions.assign(cluster_count * dim, {});
+    entrances.assign(cluster_count, {});
+    intra_distances.assign(cluster_count, {});
+    preprocessing_expansions = 0;
+
+    for (long long cluster = 0; cluster < cluster_count; cluster++) {
+        for (int axis = 0; axis < dim; axis++) compute_face(cluster, axis);
+    }
+    for (long long cluster = 0; cluster < cluster_count; cluster++) compute_cluster(cluster);
+    rebuild_graph();
+}
+
+void ClusterAbstraction::rebuild_cluster(long long cluster)
+{
+    if (transitions.empty()) {
+        build();
+        return;
+    }
+    const int dim = env->get_shape().get_dim();
+
+    // Faces du cluster (vers les voisins supérieurs et depuis les voisins inférieurs)
+    std::vector<long long> affected = {cluster};
+    for (int axis = 0; axis < dim; axis++) {
+        compute_face(cluster, axis);
+        int c = cluster_shape.coord(cluster, axis);
+        if (c > 0) {
+            compute_face(cluster - cluster_shape.stride(axis), axis);
+            affected.push_back(cluster - cluster_shape.stride(axis));
+        }
+        if (c + 1 < cluster_shape.size(axis)) affected.push_back(cluster + cluster_shape.stride(axis));
+    }
+    for (long long neighbor : affected) compute_cluster(neighbor);
+    rebuild_graph();
+}
+
+void ClusterAbstraction::update_cells(const std::vector<long long>& cells)
+{
+    std::vector<long long> clusters;
+    for (long long cell : cells) clusters.push_back(cluster_of(cell));
+    std::sort(clusters.begin(), clusters.end());
+    clusters.erase(std::unique(clusters.begin(), clusters.end()), clusters.end());
+    for (long long cluster : clusters) rebuild_cluster(cluster);
+}
+
+// =====================================================================
+// Requête
+// =====================================================================
+
+HPAStar::HPAStar(const ClusterAbstraction* cluster_abstraction)
+    : abstraction(cluster_abstraction), cost(std::numeric_limits<float>::infinity())
+{
+    if (!abstraction) {
+        throw std::invalid_argument("HPAStar: abstraction cannot be nullptr.");
+    }
+}
+
+float HPAStar::estimate(long long cell, long long goal) const
+{
+    const GridShape& shape = abstraction->get_environment().get_shape();
+    int distance = 0;
+    for (int axis = 0; axis < shape.get_dim(); axis++) {
+        distance += std::abs(shape.coord(cell, axis) - shape.coord(goal, axis));
+    }
+    return abstraction->get_edge_cost() * distance;
+}
+
+bool HPAStar::find_path(const std::vector<float>& start, const std::vector<float>& goal)
+{
+    const Environnement& env = abstraction->get_environment();
+    path.clear();
+    abstract_path.clear();
+    cost = std::numeric_limits<float>::infinity();
+    stats = HPAStatistics();
+
+    long long source = env.index_of(start);
+    long long target = env.index_of(goal);
+    if (source < 0 || target < 0 || env.is_obstacle(source) || env.is_obstacle(target)) return false;
+
+    // Insertion du départ et de l'arrivée : Dijkstra local dans leur cluster
+    std::vector<int> lower, upper;
+    long long source_cluster = abstraction->cluster_of(source);
+    long long target_cluster = abstraction->cluster_of(target);
+    abstraction->cluster_bounds(source_cluster, lower, upper);
+    ClusterAbstraction::LocalSearch source_search(env, lower, upper, abstraction->get_edge_cost());
+    source_search.run(source);
+    abstraction->cluster_bounds(target_cluster, lower, upper);
+    ClusterAbstraction::LocalSearch target_search(env, lower, upper, abstraction->get_edge_cost());
+    target_search.run(target);
+    stats.local_expansions += source_search.get_expansions() + target_search.get_expansions();
+
+    const int node_count = abstraction->get_node_count();
+    const int start_node = node_count;
+    const int goal_node = node_count + 1;
+    auto cell_of = [&](int node) {
+        return node == start_node ? source : node == goal_node ? target : abstraction->get_node_cell(node);
+    };
+
+    std::vector<ClusterAbstraction::Edge> start_edges;
+    for (long long cell : abstraction->get_entrances(source_cluster)) {
+        float distance = source_search.distance(cell);
+        if (!std::isinf(distance)) start_edges.push_back({abstraction->node_of(cell), distance});
+    }
+    if (source_cluster == target_cluster && !std::isinf(source_search.distance(target))) {
+        start_edges.push_back({goal_node, source_search.distance(target)});
+    }
+    std::unordered_map<int, float> goal_edges;
+    for (long long cell : abstraction->get_entrances(target_cluster)) {
+        float distance = target_search.distance(cell);
+        if (!std::isinf(distance)) goal_edges[abstraction->node_of(cell)] = distance;
+    }
+
+    // A* sur le graphe abstrait
+    std::vector<float> values(node_count + 2, std::numeric_limits<float>::infinity());
+    std::vector<int> parents(node_count + 2, -1);
+    std::vector<char> closed(node_count + 2, 0);
+    std::unique_ptr<FrontQueue> open = FrontQueue::create(DARY_HEAP);
+    open->resize(node_count + 2);
+    values[start_node] = 0.0f;
+    open->push(start_node, estimate(source, target));
+
+    auto relax = [&](int from, int to, float length) {
+        if (closed[to]) return;
+        float value = values[from] + length;
+        if (value < values[to]) {
+            values[to] = value;
+            parents[to] = from;
+            open->push(to, value + estimate(cell_of(to), target));
+        }
+    };
+
+    while (!open->empty()) {
+        int current = static_cast<int>(open->pop().index);
+        if (current == goal_node) break;
+        closed[current] = 1;
+        stats.abstract_expansions++;
+
+        if (current == start_node) {
+            for (const auto& edge : start_edges) relax(current, edge.target, edge.cost);
+            continue;
+        }
+        for (const auto& edge : abstraction->get_edges(current)) relax(current, edge.target, edge.cost);
+        auto to_goal = goal_edges.find(current);
+        if (to_goal != goal_edges.end()) relax(current, goal_node, to_goal->second);
+    }
+    if (std::isinf(values[goal_node])) return false;
+
+    std::vector<int> nodes;
+    for (int node = goal_node; node >= 0; node = parents[node]) nodes.push_back(node);
+    std::reverse(nodes.begin(), nodes.end());
+    for (int node : nodes) abstract_path.push_back(cell_of(node));
+    cost = values[goal_node];
+
+    // Raffinement : seuls les clusters traversés sont parcourus cellule par cellule
+    path.push_back(source);
+    for (size_t k = 1; k < abstract_path.size(); k++) {
+        long long from = abstract_path[k - 1];
+        long long to = abstract_path[k];
+        long long cluster = abstraction->cluster_of(from);
+        if (cluster != abstraction->cluster_of(to)) {
+            path.push_back(to);
+            continue;
+        }
+        std::vector<long long> segment;
+        if (k == 1) {
+            segment = source_search.path_to(to);
+        } else {
+            abstraction->cluster_bounds(cluster, lower, upper);
+            ClusterAbstraction::LocalSearch refine(env, lower, upper, abstraction->get_edge_cost());
+            refine.run(from);
+            stats.local_expansions += refine.get_expansions();
+            segment = refine.path_to(to);
+        }
+        path.insert(path.end(), segment.begin() + 1, segment.end());
+    }
+    return true;
+}
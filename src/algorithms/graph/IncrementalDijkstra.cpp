@@ -0,0 +1,148 @@
+#include "algorithms/graph/IncrementalDijkstra.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+IncrementalDijkstra::IncrementalDijkstra(Environnement* environment, float cost)
+    : Dijkstra(environment, cost), solved(false), solved_cost(cost), solved_cost_field_version(0), solved_neighborhood(nullptr),
+      last_incremental(false) {}
+
+void IncrementalDijkstra::update_cells(const std::vector<long long>& cells)
+{
+    pending.insert(pending.end(), cells.begin(), cells.end());
+}
+
+void IncrementalDijkstra::initialize_starts()
+{
+    seeds = seed_cells(starts);
+    Dijkstra::initialize_starts();
+}
+
+bool IncrementalDijkstra::can_repair() const
+{
+    return solved && queue_policy == DARY_HEAP && get_edge_cost() == solved_cost &&
+           env->get_cost_field_version() == solved_cost_field_version &&
+           neighborhood == solved_neighborhood && !(neighborhood && neighborhood->has_swept_cells()) &&
+           workspace.size() == env->get_shape().get_total();
+}
+
+void IncrementalDijkstra::execute()
+{
+    if (starts.empty()) {
+        std::cerr << "Aucun point de départ défini!" << std::endl;
+        return;
+    }
+
+    if (can_repair()) {
+        repair();
+        last_incremental = true;
+    } else {
+        // Calcul complet (boucles spécialisées de Dijkstra), puis rhs = g : tout est cohérent
+        Dijkstra::execute();
+        rhs.assign(workspace.size(), std::numeric_limits<float>::infinity());
+        for (long long index = 0; index < workspace.size(); index++) rhs[index] = workspace.get_value(index);
+        solved = true;
+        solved_cost = get_edge_cost();
+        solved_cost_field_version = env->get_cost_field_version();
+        solved_neighborhood = neighborhood;
+        last_incremental = false;
+    }
+    pending.clear();
+}
+
+bool IncrementalDijkstra::is_free(long long index) const
+{
+    return env->has_index(index) && !env->is_obstacle(index);
+}
+
+void IncrementalDijkstra::refresh(long long index)
+{
+    if (workspace.get_value(index) != rhs[index]) {
+        workspace.set_state(index, FRONT);
+        push_front(index, std::min(workspace.get_value(index), rhs[index]));
+    } else {
+        if (front->contains(index)) front->erase(index);
+        workspace.set_state(index, std::isinf(rhs[index]) ? FAR : FROZEN);
+    }
+}
+
+void IncrementalDijkstra::update_vertex(long long index)
+{
+    float best = std::numeric_limits<float>::infinity();
+    long long parent = -1;
+    if (is_free(index)) {
+        for (const auto& seed : seeds) {
+            if (seed.first == index) best = std::min(best, seed.second);
+        }
+        for_each_neighbor(index, [&](long long neighbor, float step_length) {
+            if (!is_free(neighbor) || std::isinf(workspace.get_value(neighbor))) return;
+            float candidate = calculate_new_value(neighbor, index, step_length);
+            if (candidate < best) {
+                best = candidate;
+                parent = neighbor;
+            }
+        });
+    }
+    rhs[index] = best;
+    if (parent >= 0) workspace.set_parent(index, parent);
+    else workspace.clear_parent(index);
+    refresh(index);
+}
+
+void IncrementalDijkstra::repair()
+{
+    stats = SearchStatistics();
+    front->clear();
+
+    // Départs ajoutés ou retirés
+    std::vector<std::pair<long long, float>> new_seeds = seed_cells(starts);
+    if (new_seeds != seeds) {
+        for (const auto& seed : seeds) pending.push_back(seed.first);
+        for (const auto& seed : new_seeds) pending.push_back(seed.first);
+        seeds = std::move(new_seeds);
+    }
+
+    for (long long cell : pending) {
+        if (!env->has_index(cell)) continue;
+        update_vertex(cell);
+        for_each_neighbor(cell, [&](long long neighbor, float) {
+            if (env->has_index(neighbor)) update_vertex(neighbor);
+        });
+    }
+
+    while (!front->empty()) {
+        long long current = front->pop().index;
+        stats.pops++;
+        stats.expansions++;
+
+        if (workspace.get_value(current) > rhs[current]) {
+            // Surcohérente : la valeur baisse et devient définitive
+            workspace.set_value(current, rhs[current]);
+            workspace.set_state(current, FROZEN);
+            for_each_neighbor(current, [&](long long neighbor, float step_length) {
+                if (!is_free(neighbor)) return;
+                float candidate = calculate_new_value(current, neighbor, step_length);
+                if (candidate < rhs[neighbor]) {
+                    rhs[neighbor] = candidate;
+                    workspace.set_parent(neighbor, current);
+                    refresh(neighbor);
+                }
+            });
+        } else {
+            // Sous-cohérente : la valeur repasse à l'infini, les descendants sont recalculés
+            workspace.set_value(current, std::numeric_limits<float>::infinity());
+            update_vertex(current);
+            for_each_neighbor(current, [&](long long neighbor, float) {
+                if (is_free(neighbor) && workspace.has_parent(neighbor) &&
+                    static_cast<long long>(workspace.get_parent(neighbor)) == current) {
+                    update_vertex(neighbor);
+                }
+            });
+        }
+    }
+
+    if (verbose) {
+        std::cout << "Réparation terminée. Points traités: " << stats.expansions << std::endl;
+    }
+}
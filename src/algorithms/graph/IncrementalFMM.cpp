@@ -0,0 +1,184 @@
+#include "algorithms/graph/IncrementalFMM.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+namespace {
+
+/**
+ * @brief Baisse relative en deçà de laquelle une cellule hors région garde sa valeur
+ * (les écarts d'arrondi dus à l'ordre des mises à jour ne sont pas propagés)
+ */
+constexpr float LOWERING_TOLERANCE = 1e-5f;
+
+}
+
+IncrementalFMM::IncrementalFMM(Environnement* environment, float cost)
+    : FMM(environment, cost), solved(false), solved_cost(cost), solved_cost_version(0), last_incremental(false) {}
+
+void IncrementalFMM::update_cells(const std::vector<long long>& cells)
+{
+    pending.insert(pending.end(), cells.begin(), cells.end());
+}
+
+void IncrementalFMM::initialize_starts()
+{
+    seeds = seed_cells(starts);
+    FMM::initialize_starts();
+}
+
+bool IncrementalFMM::can_repair() const
+{
+    return solved && queue_policy == DARY_HEAP && !neighborhood && get_stencil_order() == FIRST_ORDER &&
+           get_cost_per_unit_distance() == solved_cost && env->get_cost_version() == solved_cost_version &&
+           workspace.size() == env->get_shape().get_total();
+}
+
+void IncrementalFMM::execute()
+{
+    if (starts.empty()) {
+        std::cerr << "Aucun point de départ défini!" << std::endl;
+        return;
+    }
+
+    if (can_repair()) {
+        repair();
+        last_incremental = true;
+    } else {
+        FMM::execute();
+        in_region.assign(workspace.size(), 0);
+        region.clear();
+        solved = true;
+        solved_cost = get_cost_per_unit_distance();
+        solved_cost_version = env->get_cost_version();
+        last_incremental = false;
+    }
+    pending.clear();
+}
+
+bool IncrementalFMM::is_free(long long index) const
+{
+    return env->has_index(index) && !env->is_obstacle(index);
+}
+
+bool IncrementalFMM::depends_on(long long cell, long long upwind) const
+{
+    float value = workspace.get_value(cell);
+    float upwind_value = workspace.get_value(upwind);
+    if (std::isinf(value) || cell == upwind) return false;
+
+    long long neighbors[Environnement::MAX_AXIS_NEIGHBORS];
+    int count = env->get_neigh(cell, neighbors);
+    for (int i = 0; i < count; i += 2) {
+        if (neighbors[i] != upwind && neighbors[i + 1] != upwind) continue;
+        float axis_min = std::min(workspace.get_value(neighbors[i]), workspace.get_value(neighbors[i + 1]));
+        // Valeur amont de l'axe ; la marge couvre les solutions quadratiques non causales du schéma
+        if (upwind_value == axis_min && upwind_value < value + cell_cost(cell)) return true;
+    }
+    return false;
+}
+
+void IncrementalFMM::mark(long long index)
+{
+    in_region[index] = 1;
+    region.push_back(index);
+}
+
+void IncrementalFMM::invalidate_region()
+{
+    // Fermeture des dépendances sur les valeurs avant modification
+    std::vector<long long> stack;
+    for (long long cell : pending) {
+        if (env->has_index(cell) && !in_region[cell]) {
+            mark(cell);
+            stack.push_back(cell);
+        }
+    }
+    long long neighbors[Environnement::MAX_AXIS_NEIGHBORS];
+    while (!stack.empty()) {
+        long long upwind = stack.back();
+        stack.pop_back();
+        if (std::isinf(workspace.get_value(upwind))) continue;
+        int count = env->get_neigh(upwind, neighbors);
+        for (int k = 0; k < count; k++) {
+            long long cell = neighbors[k];
+            if (in_region[cell] || !depends_on(cell, upwind)) continue;
+            mark(cell);
+            stack.push_back(cell);
+        }
+    }
+
+    for (long long cell : region) {
+        workspace.set_value(cell, std::numeric_limits<float>::infinity());
+        workspace.set_state(cell, FAR);
+        workspace.clear_parent(cell);
+    }
+}
+
+void IncrementalFMM::repair()
+{
+    stats = SearchStatistics();
+    front->clear();
+    for (long long cell : region) in_region[cell] = 0;
+    region.clear();
+
+    // Départs ajoutés ou retirés
+    std::vector<std::pair<long long, float>> new_seeds = seed_cells(starts);
+    if (new_seeds != seeds) {
+        for (const auto& seed : seeds) pending.push_back(seed.first);
+        for (const auto& seed : new_seeds) pending.push_back(seed.first);
+        seeds = std::move(new_seeds);
+    }
+
+    invalidate_region();
+
+    // Valeurs initiales de la région : départs et bordure valide
+    for (long long cell : region) {
+        if (!is_free(cell)) continue;
+        float value = calculate_new_value(cell, cell, 1.0f);
+        for (const auto& seed : seeds) {
+            if (seed.first == cell) value = std::min(value, seed.second);
+        }
+        if (std::isinf(value)) continue;
+        workspace.set_value(cell, value);
+        workspace.set_state(cell, FRONT);
+        push_front(cell, value);
+    }
+
+    // Marche rapide sur la région, étendue aux cellules dont la valeur baisse
+    long long neighbors[Environnement::MAX_AXIS_NEIGHBORS];
+    while (!front->empty()) {
+        long long current = front->pop().index;
+        stats.pops++;
+        workspace.set_state(current, FROZEN);
+        stats.expansions++;
+
+        int count = env->get_neigh(current, neighbors);
+        for (int k = 0; k < count; k++) {
+            long long neighbor = neighbors[k];
+            if (neighbor == current || !is_free(neighbor)) continue;
+            if (in_region[neighbor] && workspace.get_state(neighbor) == FROZEN) continue;
+
+            float new_value = calculate_new_value(current, neighbor, 1.0f);
+            float old_value = workspace.get_value(neighbor);
+            if (!in_region[neighbor]) {
+                // Valeur encore valide : elle ne rejoint la marche que si elle baisse nettement
+                bool lowered = std::isinf(old_value) ? !std::isinf(new_value)
+                                                     : new_value < old_value - LOWERING_TOLERANCE * std::max(1.0f, old_value);
+                if (!lowered) continue;
+                mark(neighbor);
+            } else if (workspace.get_state(neighbor) != FAR && new_value >= old_value) {
+                continue;
+            }
+            workspace.set_value(neighbor, new_value);
+            workspace.set_parent(neighbor, current);
+            workspace.set_state(neighbor, FRONT);
+            push_front(neighbor, new_value);
+        }
+    }
+
+    if (verbose) {
+        std::cout << "Réparation terminée. Points traités: " << stats.expansions << std::endl;
+    }
+}
@@ -0,0 +1,182 @@
+#include "algorithms/graph/JPS.hpp"
+#include "utils/PathExtractor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace {
+
+int sign(int value) { return (value > 0) - (value < 0); }
+
+}
+
+JPS::JPS(Environnement* environment, float cost, HeuristicStrategy* heuristic_strat)
+    : AStar(environment, cost, heuristic_strat)
+{
+    if (!heuristic_strat) {
+        set_heuristic_strategy(&default_heuristic);
+    }
+}
+
+void JPS::initialize_starts()
+{
+    grid = JumpGrid(*env);
+
+    jump_targets.clear();
+    for (const auto& end_coords : ends) {
+        for (const auto& corner : env->get_hypercube_corners_with_weights(end_coords)) {
+            jump_targets.push_back(corner.first);
+        }
+    }
+
+    AStar::initialize_starts();
+    jump_targets.insert(jump_targets.end(), goal_cells.begin(), goal_cells.end());
+}
+
+bool JPS::is_target(long long index) const
+{
+    for (long long target : jump_targets) {
+        if (target == index) return true;
+    }
+    return false;
+}
+
+void JPS::process_point(long long current)
+{
+    int x = grid.x_of(current);
+    int y = grid.y_of(current);
+
+    // Direction d'arrivée depuis le point de saut parent
+    int dx = 0, dy = 0;
+    if (workspace.has_parent(current)) {
+        long long parent = workspace.get_parent(current);
+        dx = sign(x - grid.x_of(parent));
+        dy = sign(y - grid.y_of(parent));
+    }
+
+    int directions[JumpGrid::DIRECTIONS];
+    int count = grid.successor_directions(x, y, dx, dy, directions);
+    for (int k = 0; k < count; k++) {
+        int direction = directions[k];
+        int steps = 0;
+        if (!jump(x, y, direction, steps)) continue;
+
+        int jx = x + steps * JumpGrid::DX[direction];
+        int jy = y + steps * JumpGrid::DY[direction];
+        float step_length = (direction % 2 == 1) ? std::sqrt(2.0f) : 1.0f;
+        relax_neighbor(current, grid.index_of(jx, jy), steps * step_length);
+    }
+}
+
+bool JPS::jump_straight(int x, int y, int dx, int dy, int& steps) const
+{
+    for (steps = 1;; steps++) {
+        x += dx;
+        y += dy;
+        if (!grid.walkable(x, y)) return false;
+        if (is_target(grid.index_of(x, y)) || grid.has_forced_neighbor(x, y, dx, dy)) return true;
+    }
+}
+
+bool JPS::jump(int x, int y, int direction, int& steps) const
+{
+    int dx = JumpGrid::DX[direction];
+    int dy = JumpGrid::DY[direction];
+    if (dx == 0 || dy == 0) {
+        return jump_straight(x, y, dx, dy, steps);
+    }
+
+    // Diagonale : s'arrête dès qu'un saut orthogonal depuis la cellule trouve un point de saut
+    for (steps = 1;; steps++) {
+        x += dx;
+        y += dy;
+        if (!grid.walkable(x, y)) return false;
+        if (is_target(grid.index_of(x, y)) || grid.has_forced_neighbor(x, y, dx, dy)) return true;
+        int straight_steps = 0;
+        if (jump_straight(x, y, dx, 0, straight_steps) || jump_straight(x, y, 0, dy, straight_steps)) return true;
+    }
+}
+
+std::vector<long long> JPS::extract_path(const std::vector<float>& goal) const
+{
+    long long goal_index = env->index_of(goal);
+    if (goal_index < 0 || std::isinf(workspace.get_value(goal_index))) return {};
+
+    // Les parents relient des points de saut alignés : on remplit chaque segment
+    std::vector<long long> jump_points = PathExtractor::extractPath(workspace, goal_index);
+    std::vector<long long> path;
+    for (size_t k = 0; k < jump_points.size(); k++) {
+        int x = grid.x_of(jump_points[k]);
+        int y = grid.y_of(jump_points[k]);
+        if (k > 0) {
+            int px = grid.x_of(jump_points[k - 1]);
+            int py = grid.y_of(jump_points[k - 1]);
+            int dx = sign(x - px), dy = sign(y - py);
+            for (px += dx, py += dy; px != x || py != y; px += dx, py += dy) {
+                path.push_back(grid.index_of(px, py));
+            }
+        }
+        path.push_back(jump_points[k]);
+    }
+    return path;
+}
+
+JPSPlus::JPSPlus(Environnement* environment, float cost, HeuristicStrategy* heuristic_strat)
+    : JPS(environment, cost, heuristic_strat) {}
+
+void JPSPlus::set_jump_table(std::shared_ptr<const JumpPointTable> jump_table)
+{
+    if (jump_table && !jump_table->matches(*env)) {
+        throw std::invalid_argument("JPSPlus::set_jump_table: table computed for another map or obstacle layout.");
+    }
+    table = std::move(jump_table);
+}
+
+void JPSPlus::rebuild_jump_table()
+{
+    table = std::make_shared<JumpPointTable>(*env);
+}
+
+void JPSPlus::initialize_starts()
+{
+    if (!table || !table->matches(*env)) {
+        rebuild_jump_table();
+    }
+    JPS::initialize_starts();
+}
+
+bool JPSPlus::jump(int x, int y, int direction, int& steps) const
+{
+    int dx = JumpGrid::DX[direction];
+    int dy = JumpGrid::DY[direction];
+    int distance = table->get_distance(grid.index_of(x, y), direction);
+    int free_steps = std::abs(distance);
+
+    // Arrivée atteignable avant le point de saut ou le mur : on s'y arrête
+    int best = 0;
+    for (long long target : jump_targets) {
+        int rx = (grid.x_of(target) - x) * dx;
+        int ry = (grid.y_of(target) - y) * dy;
+        int reach = 0;
+        if (dy == 0) {
+            if (grid.y_of(target) == y && rx > 0) reach = rx;
+        } else if (dx == 0) {
+            if (grid.x_of(target) == x && ry > 0) reach = ry;
+        } else if (rx > 0 && ry > 0) {
+            // Dans le quadrant : la cellule diagonale alignée avec l'arrivée
+            reach = std::min(rx, ry);
+        }
+        if (reach > 0 && reach <= free_steps && (best == 0 || reach < best)) best = reach;
+    }
+    if (best > 0) {
+        steps = best;
+        return true;
+    }
+
+    if (distance > 0) {
+        steps = distance;
+        return true;
+    }
+    return false;
+}
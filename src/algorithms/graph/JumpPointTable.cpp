@@ -0,0 +1,127 @@
+#include "algorithms/graph/JumpPointTable.hpp"
+#include <stdexcept>
+
+const int JumpGrid::DX[JumpGrid::DIRECTIONS] = {1, 1, 0, -1, -1, -1, 0, 1};
+const int JumpGrid::DY[JumpGrid::DIRECTIONS] = {0, 1, 1, 1, 0, -1, -1, -1};
+
+JumpGrid::JumpGrid()
+    : env(nullptr), obstacles(nullptr), width(0), height(0), stride_x(0), stride_y(0) {}
+
+JumpGrid::JumpGrid(const Environnement& environment) : JumpGrid()
+{
+    const GridShape& shape = environment.get_shape();
+    if (shape.get_dim() != 2) {
+        throw std::invalid_argument("JumpGrid: Jump Point Search requires a 2D environment.");
+    }
+    if (environment.is_periodic(0) || environment.is_periodic(1)) {
+        throw std::invalid_argument("JumpGrid: periodic environments are not supported.");
+    }
+    env = &environment;
+    obstacles = environment.get_obstacle_data();
+    width = shape.size(0);
+    height = shape.size(1);
+    stride_x = shape.stride(0);
+    stride_y = shape.stride(1);
+}
+
+bool JumpGrid::has_forced_neighbor(int x, int y, int dx, int dy) const
+{
+    if (dx != 0 && dy != 0) {
+        // Diagonale : obstacle derrière sur un des deux axes
+        return (!walkable(x - dx, y) && walkable(x - dx, y + dy)) ||
+               (!walkable(x, y - dy) && walkable(x + dx, y - dy));
+    }
+    if (dx != 0) {
+        return (!walkable(x, y + 1) && walkable(x + dx, y + 1)) ||
+               (!walkable(x, y - 1) && walkable(x + dx, y - 1));
+    }
+    return (!walkable(x + 1, y) && walkable(x + 1, y + dy)) ||
+           (!walkable(x - 1, y) && walkable(x - 1, y + dy));
+}
+
+int JumpGrid::successor_directions(int x, int y, int dx, int dy, int* directions) const
+{
+    int count = 0;
+    if (dx == 0 && dy == 0) {
+        for (int d = 0; d < DIRECTIONS; d++) directions[count++] = d;
+        return count;
+    }
+
+    if (dx != 0 && dy != 0) {
+        // Voisins naturels : les deux composantes et la diagonale
+        directions[count++] = direction_of(dx, 0);
+        directions[count++] = direction_of(0, dy);
+        directions[count++] = direction_of(dx, dy);
+        if (!walkable(x - dx, y) && walkable(x - dx, y + dy)) directions[count++] = direction_of(-dx, dy);
+        if (!walkable(x, y - dy) && walkable(x + dx, y - dy)) directions[count++] = direction_of(dx, -dy);
+    } else if (dx != 0) {
+        directions[count++] = direction_of(dx, 0);
+        if (!walkable(x, y + 1) && walkable(x + dx, y + 1)) directions[count++] = direction_of(dx, 1);
+        if (!walkable(x, y - 1) && walkable(x + dx, y - 1)) directions[count++] = direction_of(dx, -1);
+    } else {
+        directions[count++] = direction_of(0, dy);
+        if (!walkable(x + 1, y) && walkable(x + 1, y + dy)) directions[count++] = direction_of(1, dy);
+        if (!walkable(x - 1, y) && walkable(x - 1, y + dy)) directions[count++] = direction_of(-1, dy);
+    }
+    return count;
+}
+
+int JumpGrid::direction_of(int dx, int dy)
+{
+    for (int d = 0; d < DIRECTIONS; d++) {
+        if (DX[d] == dx && DY[d] == dy) return d;
+    }
+    return -1;
+}
+
+JumpPointTable::JumpPointTable(const Environnement& environment)
+    : grid(environment), obstacle_version(environment.get_obstacle_version())
+{
+    distances.assign(static_cast<size_t>(environment.get_shape().get_total()) * JumpGrid::DIRECTIONS, 0);
+
+    // Les diagonales utilisent les distances orthogonales de la cellule suivante
+    for (int d = 0; d < JumpGrid::DIRECTIONS; d += 2) fill_direction(d);
+    for (int d = 1; d < JumpGrid::DIRECTIONS; d += 2) fill_direction(d);
+}
+
+bool JumpPointTable::matches(const Environnement& environment) const
+{
+    const GridShape& shape = environment.get_shape();
+    return shape.get_dim() == 2 && shape.size(0) == grid.get_width() && shape.size(1) == grid.get_height() &&
+           environment.get_obstacle_version() == obstacle_version;
+}
+
+void JumpPointTable::fill_direction(int direction)
+{
+    const int dx = JumpGrid::DX[direction];
+    const int dy = JumpGrid::DY[direction];
+    const int width = grid.get_width();
+    const int height = grid.get_height();
+
+    // Parcours à rebours : la cellule suivante (x + dx, y + dy) est toujours déjà calculée
+    for (int i = 0; i < width; i++) {
+        int x = dx > 0 ? width - 1 - i : i;
+        for (int j = 0; j < height; j++) {
+            int y = dy > 0 ? height - 1 - j : j;
+            if (!grid.walkable(x, y)) continue;
+
+            int nx = x + dx, ny = y + dy;
+            int distance = 0;
+            if (grid.walkable(nx, ny)) {
+                long long next = grid.index_of(nx, ny);
+                bool jump_point = grid.has_forced_neighbor(nx, ny, dx, dy);
+                if (!jump_point && dx != 0 && dy != 0) {
+                    jump_point = get_distance(next, JumpGrid::direction_of(dx, 0)) > 0 ||
+                                 get_distance(next, JumpGrid::direction_of(0, dy)) > 0;
+                }
+                if (jump_point) {
+                    distance = 1;
+                } else {
+                    int following = get_distance(next, direction);
+                    distance = following > 0 ? following + 1 : following - 1;
+                }
+            }
+            distances[grid.index_of(x, y) * JumpGrid::DIRECTIONS + direction] = distance;
+        }
+    }
+}
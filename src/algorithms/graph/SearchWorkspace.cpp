@@ -0,0 +1,21 @@
+#include "algorithms/graph/SearchWorkspace.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+void SearchWorkspace::resize(long long cell_count)
+{
+    if (cell_count < 0 || cell_count > static_cast<long long>(NO_PARENT)) {
+        throw std::invalid_argument("SearchWorkspace: cell count does not fit in 32-bit parent indices");
+    }
+    values.resize(cell_count);
+    states.resize(cell_count);
+    parents.resize(cell_count);
+    reset();
+}
+
+void SearchWorkspace::reset()
+{
+    std::fill(values.begin(), values.end(), INFINITY);
+    std::fill(states.begin(), states.end(), static_cast<std::uint8_t>(FAR));
+    std::fill(parents.begin(), parents.end(), NO_PARENT);
+}
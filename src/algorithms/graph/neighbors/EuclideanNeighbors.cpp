@@ -0,0 +1,113 @@
+#include "algorithms/graph/neighbors/EuclideanNeighbors.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+#include <sstream>
+
+namespace {
+    // Garde-fou sur la taille de la boîte [-R, R]^N parcourue pour construire le stencil
+    const long long MAX_STENCIL_BOX = 10000000;
+}
+
+EuclideanNeighbors::EuclideanNeighbors(float radius, bool primitive_only)
+    : NeighborhoodStrategy(), max_radius(radius), primitive_only(primitive_only)
+{
+    if (!(radius >= 1.0f)) {
+        throw std::invalid_argument("EuclideanNeighbors: radius must be >= 1");
+    }
+}
+
+std::string EuclideanNeighbors::get_name() const
+{
+    std::ostringstream name;
+    name << "Euclidean(r=" << max_radius << (primitive_only ? "" : ", all") << ")";
+    return name.str();
+}
+
+void EuclideanNeighbors::build_stencil(int num_dimensions)
+{
+    const int R = static_cast<int>(std::floor(max_radius + 1e-6f));
+    const int side = 2 * R + 1;
+    long long total = 1;
+    for (int i = 0; i < num_dimensions; i++) {
+        total *= side;
+        if (total > MAX_STENCIL_BOX) {
+            throw std::invalid_argument("EuclideanNeighbors: radius too large for " +
+                                        std::to_string(num_dimensions) + " dimensions");
+        }
+    }
+
+    // Comparaison sur les carrés entiers (rayons du type √5 sans erreur d'arrondi)
+    const float radius_sq = max_radius * max_radius + 1e-4f;
+
+    std::vector<int> offset(num_dimensions);
+    swept_begin.push_back(0);
+    for (long long code = 0; code < total; code++) {
+        long long rest = code;
+        long long length_sq = 0;
+        int divisor = 0;
+        for (int i = num_dimensions - 1; i >= 0; i--) {
+            offset[i] = static_cast<int>(rest % side) - R;
+            rest /= side;
+            length_sq += static_cast<long long>(offset[i]) * offset[i];
+            divisor = std::gcd(divisor, std::abs(offset[i]));
+        }
+
+        if (length_sq == 0) continue; // La cellule elle-même
+        if (static_cast<float>(length_sq) > radius_sq) continue;
+        if (primitive_only && divisor != 1) continue;
+
+        offsets.insert(offsets.end(), offset.begin(), offset.end());
+        costs.push_back(std::sqrt(static_cast<float>(length_sq)));
+        add_swept_cells(offset);
+        swept_begin.push_back(static_cast<int>(swept_offsets.size() / num_dimensions));
+    }
+}
+
+void EuclideanNeighbors::add_swept_cells(const std::vector<int>& offset)
+{
+    const int n = static_cast<int>(offset.size());
+
+    // Parcours de la boîte englobante de [0, offset]
+    std::vector<int> lower(n), extent(n);
+    long long box = 1;
+    for (int i = 0; i < n; i++) {
+        lower[i] = std::min(0, offset[i]);
+        extent[i] = std::abs(offset[i]) + 1;
+        box *= extent[i];
+    }
+
+    std::vector<int> c(n);
+    for (long long code = 0; code < box; code++) {
+        long long rest = code;
+        bool endpoint_origin = true, endpoint_target = true;
+        for (int i = n - 1; i >= 0; i--) {
+            c[i] = lower[i] + static_cast<int>(rest % extent[i]);
+            rest /= extent[i];
+            if (c[i] != 0) endpoint_origin = false;
+            if (c[i] != offset[i]) endpoint_target = false;
+        }
+        if (endpoint_origin || endpoint_target) continue;
+
+        // Intervalle des t ∈ (0, 1) pour lesquels t·offset est à l'intérieur de la cellule c
+        double t_min = 0.0, t_max = 1.0;
+        for (int i = 0; i < n && t_min < t_max; i++) {
+            if (offset[i] == 0) {
+                if (c[i] != 0) t_max = t_min; // Axe immobile : seule la rangée 0 est traversée
+                continue;
+            }
+            double a = (c[i] - 0.5) / offset[i];
+            double b = (c[i] + 0.5) / offset[i];
+            if (a > b) std::swap(a, b);
+            t_min = std::max(t_min, a);
+            t_max = std::min(t_max, b);
+        }
+
+        // Un simple contact par un coin ou une arête ne compte pas comme traversée
+        if (t_max - t_min > 1e-9) {
+            swept_offsets.insert(swept_offsets.end(), c.begin(), c.end());
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#include "algorithms/graph/neighbors/GridNeighbors.hpp"
+#include <cmath>
+#include <stdexcept>
+
+GridNeighbors::GridNeighbors(Connectivity connectivity)
+    : NeighborhoodStrategy(), max_moving_axes(connectivity == AXIAL ? 1 : 0) {}
+
+GridNeighbors::GridNeighbors(int moving_axes)
+    : NeighborhoodStrategy(), max_moving_axes(moving_axes)
+{
+    if (moving_axes < 1) {
+        throw std::invalid_argument("GridNeighbors: moving_axes must be >= 1");
+    }
+}
+
+std::string GridNeighbors::get_name() const
+{
+    if (max_moving_axes == 1) return "Grid(axial)";
+    if (max_moving_axes == 0) return "Grid(full)";
+    return "Grid(axes<=" + std::to_string(max_moving_axes) + ")";
+}
+
+void GridNeighbors::build_stencil(int num_dimensions)
+{
+    // Parcours de {-1, 0, 1}^N dans l'ordre lexicographique
+    long long total = 1;
+    for (int i = 0; i < num_dimensions; i++) total *= 3;
+
+    std::vector<int> offset(num_dimensions);
+    for (long long code = 0; code < total; code++) {
+        long long rest = code;
+        int moving = 0;
+        for (int i = num_dimensions - 1; i >= 0; i--) {
+            offset[i] = static_cast<int>(rest % 3) - 1;
+            rest /= 3;
+            if (offset[i] != 0) moving++;
+        }
+
+        if (moving == 0) continue; // La cellule elle-même
+        if (max_moving_axes > 0 && moving > max_moving_axes) continue;
+
+        offsets.insert(offsets.end(), offset.begin(), offset.end());
+        costs.push_back(std::sqrt(static_cast<float>(moving)));
+    }
+}
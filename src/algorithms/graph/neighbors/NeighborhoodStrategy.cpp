@@ -0,0 +1,67 @@
+#include "algorithms/graph/neighbors/NeighborhoodStrategy.hpp"
+#include <stdexcept>
+#include <cstdlib>
+#include <algorithm>
+
+NeighborhoodStrategy::NeighborhoodStrategy()
+    : dims(), dim(0), radius(0) {}
+
+void NeighborhoodStrategy::set_environment(const Environnement* env)
+{
+    if (!env) {
+        throw std::invalid_argument("NeighborhoodStrategy::set_environment: env cannot be nullptr.");
+    }
+
+    if (!dims.empty() && env->get_dims() == dims) return; // Stencil déjà précalculé pour ces dimensions
+
+    dims = env->get_dims();
+    dim = static_cast<int>(dims.size());
+    offsets.clear();
+    costs.clear();
+    swept_offsets.clear();
+    swept_begin.clear();
+    build_stencil(dim);
+
+    const GridShape& shape = env->get_shape();
+    strides.assign(dim, 0);
+    for (int i = 0; i < dim; i++) strides[i] = shape.stride(i);
+
+    radius = 0;
+    linear_offsets.assign(costs.size(), 0);
+    for (size_t k = 0; k < costs.size(); k++) {
+        for (int i = 0; i < dim; i++) {
+            int o = offsets[k * dim + i];
+            linear_offsets[k] += o * strides[i];
+            radius = std::max(radius, std::abs(o));
+        }
+    }
+
+    swept_linear.assign(swept_offsets.size() / (dim > 0 ? dim : 1), 0);
+    for (size_t s = 0; s < swept_linear.size(); s++) {
+        for (int i = 0; i < dim; i++) swept_linear[s] += swept_offsets[s * dim + i] * strides[i];
+    }
+}
+
+float NeighborhoodStrategy::get_min_cost() const
+{
+    if (costs.empty()) return 1.0f;
+    return *std::min_element(costs.begin(), costs.end());
+}
+
+bool NeighborhoodStrategy::is_sweep_free(const Environnement& env, const int* coords, const bool* periodic, size_t k) const
+{
+    for (int s = swept_begin[k]; s < swept_begin[k + 1]; s++) {
+        long long cell_index = 0;
+        for (int i = 0; i < dim; i++) {
+            int c = coords[i] + swept_offsets[s * dim + i];
+            if (c < 0 || c >= dims[i]) {
+                if (!periodic[i]) return false;
+                c = ((c % dims[i]) + dims[i]) % dims[i];
+            }
+            cell_index += c * strides[i];
+        }
+        if (env.get_backend() == Environnement::MAP && !env.has_index(cell_index)) return false;
+        if (env.is_obstacle(cell_index)) return false;
+    }
+    return true;
+}
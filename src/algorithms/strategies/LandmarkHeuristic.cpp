@@ -0,0 +1,323 @@
+#include "algorithms/strategies/LandmarkHeuristic.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "Environnement.hpp"
+#include "utils/BinaryIO.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+
+namespace {
+
+const char FILE_MAGIC[4] = {'A', 'L', 'T', '1'};
+
+void run_from(GraphSearchBase& search, const Environnement& env, long long index)
+{
+    search.clear_starts();
+    search.clear_ends();
+    search.add_start(env.cell(index).get_coords());
+    search.execute();
+}
+
+}
+
+LandmarkHeuristic::LandmarkHeuristic(int count, Selection method, unsigned int random_seed)
+    : HeuristicStrategy(), landmark_count(count), selection(method), seed(random_seed), cell_count(0)
+{
+    if (count < 1) {
+        throw std::invalid_argument("LandmarkHeuristic: at least one landmark is required.");
+    }
+}
+
+void LandmarkHeuristic::preprocess(Environnement* env, GraphSearchBase* search)
+{
+    if (!env) {
+        throw std::invalid_argument("LandmarkHeuristic::preprocess: environment cannot be nullptr.");
+    }
+    set_environment(env);
+    cell_count = env->get_shape().get_total();
+    landmarks.clear();
+    distances.clear();
+    cached_goal.clear();
+
+    std::unique_ptr<Dijkstra> default_search;
+    if (!search) {
+        default_search = std::make_unique<Dijkstra>(env);
+        search = default_search.get();
+    }
+
+    std::vector<float> root_distances;
+    std::vector<long long> parents;
+    for (int round = 0; round < landmark_count; round++) {
+        long long next = -1;
+        if (selection == FARTHEST && round > 0) {
+            next = select_farthest();
+        } else {
+            long long root = choose_root(*search, round, root_distances, parents);
+            if (root < 0) break;
+            next = selection == AVOID ? select_avoid(root, root_distances, parents) : farthest_from(root_distances);
+        }
+        if (next < 0 || std::find(landmarks.begin(), landmarks.end(), next) != landmarks.end()) break;
+        landmarks.push_back(next);
+        compute_table(*search, next);
+    }
+    if (landmarks.empty()) {
+        throw std::runtime_error("LandmarkHeuristic::preprocess: no free cell to place a landmark.");
+    }
+}
+
+void LandmarkHeuristic::compute_table(GraphSearchBase& search, long long landmark)
+{
+    run_from(search, *environment, landmark);
+    const SearchWorkspace& workspace = search.get_workspace();
+    size_t offset = distances.size();
+    distances.resize(offset + cell_count);
+    for (long long index = 0; index < cell_count; index++) {
+        distances[offset + index] = workspace.get_value(index);
+    }
+}
+
+long long LandmarkHeuristic::select_farthest() const
+{
+    // Cellule maximisant la distance au repère le plus proche (atteinte depuis tous les repères)
+    long long best = -1;
+    float best_distance = 0.0f;
+    int count = static_cast<int>(landmarks.size());
+    for (long long index = 0; index < cell_count; index++) {
+        float nearest = std::numeric_limits<float>::infinity();
+        for (int l = 0; l < count; l++) nearest = std::min(nearest, get_distance(l, index));
+        if (!std::isinf(nearest) && nearest > best_distance) {
+            best_distance = nearest;
+            best = index;
+        }
+    }
+    return best;
+}
+
+long long LandmarkHeuristic::farthest_from(const std::vector<float>& root_distances) const
+{
+    long long best = -1;
+    for (long long index = 0; index < cell_count; index++) {
+        if (std::isinf(root_distances[index])) continue;
+        if (best < 0 || root_distances[index] > root_distances[best]) best = index;
+    }
+    return best;
+}
+
+long long LandmarkHeuristic::choose_root(GraphSearchBase& search, unsigned int round,
+                                         std::vector<float>& root_distances, std::vector<long long>& parents) const
+{
+    // Cellule libre aléatoire, hors repères, dans la composante du premier repère s'il existe
+    std::vector<long long> free_cells;
+    for (long long index = 0; index < cell_count; index++) {
+        if (!environment->has_index(index) || environment->is_obstacle(index)) continue;
+        if (!landmarks.empty() && std::isinf(get_distance(0, index))) continue;
+        if (std::find(landmarks.begin(), landmarks.end(), index) != landmarks.end()) continue;
+        free_cells.push_back(index);
+    }
+    if (free_cells.empty()) return -1;
+
+    // Sur une carte morcelée, garder la racine dont la composante est la plus grande
+    std::mt19937 rng(seed + round);
+    std::uniform_int_distribution<size_t> pick(0, free_cells.size() - 1);
+    long long root = -1;
+    size_t root_reach = 0;
+    for (int attempt = 0; attempt < 8 && root_reach * 2 < free_cells.size(); attempt++) {
+        long long candidate = free_cells[pick(rng)];
+        run_from(search, *environment, candidate);
+        const SearchWorkspace& workspace = search.get_workspace();
+        size_t reach = 0;
+        for (long long index = 0; index < cell_count; index++) {
+            if (!std::isinf(workspace.get_value(index))) reach++;
+        }
+        if (reach <= root_reach) continue;
+        root = candidate;
+        root_reach = reach;
+        root_distances.resize(cell_count);
+        parents.assign(cell_count, -1);
+        for (long long index = 0; index < cell_count; index++) {
+            root_distances[index] = workspace.get_value(index);
+            if (workspace.has_parent(index)) parents[index] = workspace.get_parent(index);
+        }
+    }
+    return root;
+}
+
+long long LandmarkHeuristic::select_avoid(long long root, const std::vector<float>& root_distances,
+                                          const std::vector<long long>& parents) const
+{
+    std::vector<long long> order;
+    for (long long index = 0; index < cell_count; index++) {
+        if (!std::isinf(root_distances[index])) order.push_back(index);
+    }
+
+    // Poids : erreur de la borne actuelle ; taille : somme des poids du sous-arbre sans repère
+    std::sort(order.begin(), order.end(), [&](long long a, long long b) {
+        return root_distances[a] > root_distances[b];
+    });
+    std::vector<double> size(cell_count, 0.0);
+    std::vector<char> has_landmark(cell_count, 0);
+    for (long long landmark : landmarks) has_landmark[landmark] = 1;
+    for (long long index : order) {
+        size[index] += root_distances[index] - lower_bound(root, index);
+        long long parent = parents[index];
+        if (parent >= 0) {
+            size[parent] += size[index];
+            has_landmark[parent] |= has_landmark[index];
+        }
+    }
+
+    // Descente depuis la racine vers le fils le plus lourd, jusqu'à une feuille
+    std::vector<long long> child_begin(cell_count + 1, 0);
+    for (long long index : order) {
+        if (parents[index] >= 0) child_begin[parents[index] + 1]++;
+    }
+    for (long long index = 0; index < cell_count; index++) child_begin[index + 1] += child_begin[index];
+    std::vector<long long> children(child_begin[cell_count]);
+    std::vector<long long> fill(child_begin.begin(), child_begin.end() - 1);
+    for (long long index : order) {
+        if (parents[index] >= 0) children[fill[parents[index]]++] = index;
+    }
+
+    long long current = root;
+    for (;;) {
+        long long heaviest = -1;
+        for (long long k = child_begin[current]; k < child_begin[current + 1]; k++) {
+            long long child = children[k];
+            if (has_landmark[child]) continue;
+            if (heaviest < 0 || size[child] > size[heaviest]) heaviest = child;
+        }
+        if (heaviest < 0) break;
+        current = heaviest;
+    }
+    return current;
+}
+
+float LandmarkHeuristic::lower_bound(long long from, long long to) const
+{
+    float bound = 0.0f;
+    for (int l = 0; l < static_cast<int>(landmarks.size()); l++) {
+        float a = get_distance(l, from), b = get_distance(l, to);
+        if (std::isinf(a) || std::isinf(b)) continue;
+        bound = std::max(bound, std::abs(a - b));
+    }
+    return bound;
+}
+
+void LandmarkHeuristic::prepare_goal(const std::vector<float>& goal) const
+{
+    if (goal == cached_goal) return;
+    cached_goal = goal;
+    goal_distances.clear();
+    goal_weights.clear();
+
+    std::vector<std::pair<long long, float>> corners;
+    long long index = environment->index_of(goal);
+    if (index >= 0) {
+        corners.emplace_back(index, 1.0f);
+    } else if (environment->is_in_bounds(goal)) {
+        corners = environment->get_hypercube_corners_with_weights(goal);
+    }
+
+    int count = static_cast<int>(landmarks.size());
+    for (const auto& corner : corners) {
+        if (environment->is_obstacle(corner.first)) continue;
+        goal_weights.push_back(corner.second);
+        for (int l = 0; l < count; l++) goal_distances.push_back(get_distance(l, corner.first));
+    }
+}
+
+float LandmarkHeuristic::estimate(long long index, const std::vector<float>& goal) const
+{
+    if (landmarks.empty()) return 0.0f;
+    prepare_goal(goal);
+
+    // Arrivée flottante : valeur interpolée Σ w_coin · d(n, coin), minorée coin par coin
+    // (un coin obstacle est ignoré, la somme des poids restants est < 1)
+    int count = static_cast<int>(landmarks.size());
+    float weighted = 0.0f;
+    for (size_t c = 0; c < goal_weights.size(); c++) {
+        const float* to_goal = &goal_distances[c * count];
+        float bound = 0.0f;
+        for (int l = 0; l < count; l++) {
+            float a = to_goal[l], b = distances[l * cell_count + index];
+            if (std::isinf(a) || std::isinf(b)) continue;
+            bound = std::max(bound, std::abs(a - b));
+        }
+        weighted += goal_weights[c] * bound;
+    }
+    return weighted;
+}
+
+std::string LandmarkHeuristic::get_name() const
+{
+    int count = landmarks.empty() ? landmark_count : static_cast<int>(landmarks.size());
+    return "ALT(K=" + std::to_string(count) + (selection == AVOID ? ",avoid)" : ",farthest)");
+}
+
+void LandmarkHeuristic::save(const std::string& filename) const
+{
+    if (!environment || landmarks.empty()) {
+        throw std::logic_error("LandmarkHeuristic::save: preprocess() must be called first.");
+    }
+    std::ofstream file(filename, std::ios::binary);
+    if (!file) throw std::runtime_error("LandmarkHeuristic::save: cannot open " + filename);
+
+    const GridShape& shape = environment->get_shape();
+    file.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+    BinaryIO::write_value<std::int32_t>(file, shape.get_dim());
+    for (int i = 0; i < shape.get_dim(); i++) BinaryIO::write_value<std::int32_t>(file, shape.size(i));
+    BinaryIO::write_value<std::uint64_t>(file, environment->get_obstacle_fingerprint());
+    BinaryIO::write_value<std::int32_t>(file, static_cast<std::int32_t>(landmarks.size()));
+    for (long long landmark : landmarks) BinaryIO::write_value<std::int64_t>(file, landmark);
+    BinaryIO::write_vector(file, distances);
+    if (!file) throw std::runtime_error("LandmarkHeuristic::save: write failed for " + filename);
+}
+
+void LandmarkHeuristic::load(const std::string& filename, const Environnement* env)
+{
+    if (!env) {
+        throw std::invalid_argument("LandmarkHeuristic::load: environment cannot be nullptr.");
+    }
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) throw std::runtime_error("LandmarkHeuristic::load: cannot open " + filename);
+
+    char magic[sizeof(FILE_MAGIC)];
+    file.read(magic, sizeof(magic));
+    if (!file || std::memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0) {
+        throw std::runtime_error("LandmarkHeuristic::load: " + filename + " is not a landmark file.");
+    }
+
+    const GridShape& shape = env->get_shape();
+    bool same_shape = BinaryIO::read_value<std::int32_t>(file) == shape.get_dim();
+    for (int i = 0; same_shape && i < shape.get_dim(); i++) {
+        same_shape = BinaryIO::read_value<std::int32_t>(file) == shape.size(i);
+    }
+    if (!same_shape || BinaryIO::read_value<std::uint64_t>(file) != env->get_obstacle_fingerprint()) {
+        throw std::runtime_error("LandmarkHeuristic::load: " + filename + " was computed on another map.");
+    }
+
+    int count = BinaryIO::read_value<std::int32_t>(file);
+    if (count <= 0 || count > shape.get_total()) {
+        throw std::runtime_error("LandmarkHeuristic::load: " + filename + " has an invalid landmark count.");
+    }
+    std::vector<long long> loaded_landmarks(count);
+    for (int l = 0; l < count; l++) {
+        long long index = BinaryIO::read_value<std::int64_t>(file);
+        if (index < 0 || index >= shape.get_total() || !env->has_index(index) || env->is_obstacle(index)) {
+            throw std::runtime_error("LandmarkHeuristic::load: " + filename + " has an invalid landmark cell.");
+        }
+        loaded_landmarks[l] = index;
+    }
+    std::vector<float> loaded_distances = BinaryIO::read_vector<float>(file, static_cast<size_t>(count) * shape.get_total());
+
+    set_environment(env);
+    cell_count = shape.get_total();
+    landmarks = std::move(loaded_landmarks);
+    distances = std::move(loaded_distances);
+    cached_goal.clear();
+}
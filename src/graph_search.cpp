@@ -48,10 +48,13 @@ void graph_search::execute()
     // Vider la queue
     while (!front.empty()) front.pop();
     
+    // Ce prototype stocke son état dans les Point du backend MAP
+    auto& point_map = env->get_map_ref();
+
     // Initialiser les points de départ
     for (const auto& start_coords : starts) {
-        if (env->hasPoint(start_coords)) {
-            Point& start_point = env->getPoint(start_coords);
+        if (point_map.count(start_coords) > 0) {
+            Point& start_point = point_map.at(start_coords);
             if (!start_point.get_obs()) {
                 start_point.set_value(0.0f);
                 start_point.set_state(FRONT);
@@ -71,9 +74,11 @@ void graph_search::execute()
         processed_count++;
         
         // Examiner tous les voisins
-        std::vector<Point*> neighbors = env->get_neigh(*current);
+        std::vector<long long> neighbors = env->get_neigh(env->cell(env->index_of(current->get_coords())));
         
-        for (Point* neighbor : neighbors) {
+        for (long long neighbor_index : neighbors) {
+            Point* neighbor = &point_map.at(env->cell(neighbor_index).get_coords());
+
             // Ignorer les obstacles et les points déjà traités
             if (neighbor->get_obs() || neighbor->get_state() == FROZEN) {
                 continue;
@@ -0,0 +1,154 @@
+#include "utils/BucketQueue.hpp"
+#include <cmath>
+#include <stdexcept>
+
+BucketQueue::BucketQueue(float bucket_width, bool fifo_order)
+    : width(bucket_width), fifo(fifo_order), ring(64), cursor(0), count(0)
+{
+    if (!(bucket_width > 0.0f) || std::isinf(bucket_width)) {
+        throw std::invalid_argument("BucketQueue: bucket_width must be a positive finite value.");
+    }
+}
+
+std::string BucketQueue::get_name() const
+{
+    return fifo ? "UntidyBuckets" : "DialBuckets";
+}
+
+void BucketQueue::resize(long long cell_count)
+{
+    if (cell_count < 0 || cell_count >= static_cast<long long>(NOT_IN_QUEUE)) {
+        throw std::length_error("BucketQueue::resize: cell_count exceeds 32-bit positions.");
+    }
+    bucket_of.assign(static_cast<size_t>(cell_count), NOT_IN_QUEUE);
+    slot_of.assign(static_cast<size_t>(cell_count), 0);
+    for (Bucket& bucket : ring) bucket = Bucket();
+    cursor = 0;
+    count = 0;
+}
+
+void BucketQueue::clear()
+{
+    for (Bucket& bucket : ring) {
+        for (const FrontEntry& entry : bucket.items) {
+            if (entry.index >= 0) bucket_of[entry.index] = NOT_IN_QUEUE;
+        }
+        bucket.items.clear();
+        bucket.head = 0;
+        bucket.live = 0;
+    }
+    cursor = 0;
+    count = 0;
+}
+
+long long BucketQueue::bucket_number(float key) const
+{
+    if (std::isinf(key)) {
+        throw std::invalid_argument("BucketQueue: infinite keys cannot be bucketed.");
+    }
+    long long number = static_cast<long long>(std::floor(key / width));
+    return number < cursor ? cursor : number;
+}
+
+FrontEntry BucketQueue::top() const
+{
+    return next_in(ring[cursor & (ring.size() - 1)]);
+}
+
+const FrontEntry& BucketQueue::next_in(const Bucket& bucket) const
+{
+    if (fifo) {
+        for (size_t k = bucket.head; k < bucket.items.size(); k++) {
+            if (bucket.items[k].index >= 0) return bucket.items[k];
+        }
+    } else {
+        for (size_t k = bucket.items.size(); k-- > bucket.head;) {
+            if (bucket.items[k].index >= 0) return bucket.items[k];
+        }
+    }
+    throw std::logic_error("BucketQueue: empty bucket at cursor.");
+}
+
+FrontEntry BucketQueue::pop()
+{
+    FrontEntry entry = top();
+    remove(entry.index);
+    advance_cursor();
+    return entry;
+}
+
+bool BucketQueue::push(long long index, float key)
+{
+    if (index < 0 || index >= capacity()) {
+        throw std::out_of_range("BucketQueue::push: index outside of the grid.");
+    }
+
+    bool inserted = bucket_of[index] == NOT_IN_QUEUE;
+    if (!inserted) remove(index);
+    if (count == 0) cursor = static_cast<long long>(std::floor(key / width));
+    insert(index, key);
+    advance_cursor();
+    return inserted;
+}
+
+void BucketQueue::erase(long long index)
+{
+    if (bucket_of[index] == NOT_IN_QUEUE) return;
+    remove(index);
+    advance_cursor();
+}
+
+void BucketQueue::insert(long long index, float key)
+{
+    long long number = bucket_number(key);
+    if (number - cursor >= static_cast<long long>(ring.size())) grow(number - cursor + 1);
+
+    std::uint32_t ring_index = static_cast<std::uint32_t>(number & (ring.size() - 1));
+    Bucket& bucket = ring[ring_index];
+    bucket_of[index] = ring_index;
+    slot_of[index] = static_cast<std::uint32_t>(bucket.items.size());
+    bucket.items.push_back({key, index});
+    bucket.live++;
+    count++;
+}
+
+void BucketQueue::remove(long long index)
+{
+    Bucket& bucket = ring[bucket_of[index]];
+    bucket.items[slot_of[index]].index = -1;
+    bucket_of[index] = NOT_IN_QUEUE;
+    bucket.live--;
+    count--;
+
+    if (bucket.live == 0) {
+        bucket.items.clear();
+        bucket.head = 0;
+        return;
+    }
+    // Retirer les entrées mortes aux extrémités pour garder top() en O(1)
+    while (bucket.items[bucket.head].index < 0) bucket.head++;
+    while (bucket.items.back().index < 0) bucket.items.pop_back();
+}
+
+void BucketQueue::advance_cursor()
+{
+    if (count == 0) return;
+    while (ring[cursor & (ring.size() - 1)].live == 0) cursor++;
+}
+
+void BucketQueue::grow(long long required)
+{
+    size_t new_size = ring.size();
+    while (static_cast<long long>(new_size) < required) new_size *= 2;
+
+    // Réinsérer les entrées vivantes dans l'anneau agrandi (l'ordre dans chaque seau est conservé)
+    std::vector<Bucket> old_ring(new_size);
+    old_ring.swap(ring);
+    count = 0;
+    for (long long offset = 0; offset < static_cast<long long>(old_ring.size()); offset++) {
+        const Bucket& bucket = old_ring[(cursor + offset) & (old_ring.size() - 1)];
+        for (size_t k = bucket.head; k < bucket.items.size(); k++) {
+            if (bucket.items[k].index >= 0) insert(bucket.items[k].index, bucket.items[k].value);
+        }
+    }
+}
@@ -0,0 +1,20 @@
+#include "utils/FrontQueue.hpp"
+#include "utils/IndexedHeap.hpp"
+#include "utils/BucketQueue.hpp"
+#include "utils/RadixHeap.hpp"
+#include <stdexcept>
+
+std::unique_ptr<FrontQueue> FrontQueue::create(QueuePolicy policy, float bucket_width)
+{
+    switch (policy) {
+        case DARY_HEAP:
+            return std::make_unique<IndexedHeap>();
+        case DIAL_BUCKETS:
+            return std::make_unique<BucketQueue>(bucket_width, false);
+        case RADIX_HEAP:
+            return std::make_unique<RadixHeap>();
+        case UNTIDY_BUCKETS:
+            return std::make_unique<BucketQueue>(bucket_width, true);
+    }
+    throw std::invalid_argument("FrontQueue::create: unknown queue policy.");
+}
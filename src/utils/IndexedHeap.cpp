@@ -0,0 +1,107 @@
+#include "utils/IndexedHeap.hpp"
+#include <stdexcept>
+
+void IndexedHeap::resize(long long cell_count)
+{
+    if (cell_count < 0 || cell_count >= static_cast<long long>(NOT_IN_HEAP)) {
+        throw std::length_error("IndexedHeap::resize: cell_count exceeds 32-bit positions.");
+    }
+    heap.clear();
+    position.assign(static_cast<size_t>(cell_count), NOT_IN_HEAP);
+}
+
+void IndexedHeap::clear()
+{
+    for (const FrontEntry& entry : heap) {
+        position[entry.index] = NOT_IN_HEAP;
+    }
+    heap.clear();
+}
+
+FrontEntry IndexedHeap::pop()
+{
+    FrontEntry root = heap.front();
+    position[root.index] = NOT_IN_HEAP;
+
+    FrontEntry last = heap.back();
+    heap.pop_back();
+    if (!heap.empty()) {
+        place(0, last);
+        sift_down(0);
+    }
+    return root;
+}
+
+bool IndexedHeap::push(long long index, float key)
+{
+    if (index < 0 || index >= capacity()) {
+        throw std::out_of_range("IndexedHeap::push: index outside of the grid.");
+    }
+
+    std::uint32_t pos = position[index];
+    if (pos == NOT_IN_HEAP) {
+        heap.push_back({key, index});
+        position[index] = static_cast<std::uint32_t>(heap.size() - 1);
+        sift_up(heap.size() - 1);
+        return true;
+    }
+
+    float old_key = heap[pos].value;
+    heap[pos].value = key;
+    if (key < old_key) sift_up(pos);
+    else sift_down(pos);
+    return false;
+}
+
+void IndexedHeap::erase(long long index)
+{
+    std::uint32_t pos = position[index];
+    if (pos == NOT_IN_HEAP) return;
+    position[index] = NOT_IN_HEAP;
+
+    FrontEntry last = heap.back();
+    heap.pop_back();
+    if (pos < heap.size()) {
+        place(pos, last);
+        sift_up(pos);
+        sift_down(position[last.index]);
+    }
+}
+
+void IndexedHeap::place(size_t pos, const FrontEntry& entry)
+{
+    heap[pos] = entry;
+    position[entry.index] = static_cast<std::uint32_t>(pos);
+}
+
+void IndexedHeap::sift_up(size_t pos)
+{
+    FrontEntry entry = heap[pos];
+    while (pos > 0) {
+        size_t parent = (pos - 1) / ARITY;
+        if (!(entry.value < heap[parent].value)) break;
+        place(pos, heap[parent]);
+        pos = parent;
+    }
+    place(pos, entry);
+}
+
+void IndexedHeap::sift_down(size_t pos)
+{
+    FrontEntry entry = heap[pos];
+    const size_t count = heap.size();
+    while (true) {
+        size_t first_child = pos * ARITY + 1;
+        if (first_child >= count) break;
+
+        size_t last_child = first_child + ARITY < count ? first_child + ARITY : count;
+        size_t best = first_child;
+        for (size_t child = first_child + 1; child < last_child; child++) {
+            if (heap[child].value < heap[best].value) best = child;
+        }
+        if (!(heap[best].value < entry.value)) break;
+        place(pos, heap[best]);
+        pos = best;
+    }
+    place(pos, entry);
+}
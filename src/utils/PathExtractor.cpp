@@ -1,4 +1,5 @@
 #include "utils/PathExtractor.hpp"
+#include <algorithm>
 
 // TODO: Implémenter les fonctions d'extraction de chemins
 
@@ -15,6 +16,20 @@ std::vector<Point*> PathExtractor::extractPath(Point* goal) {
     return path;
 }
 
+std::vector<long long> PathExtractor::extractPath(const SearchWorkspace& workspace, long long goal) {
+    std::vector<long long> path;
+
+    long long current = goal;
+    while (current >= 0 && current < workspace.size() && workspace.get_value(current) != INFINITY) {
+        path.push_back(current);
+        if (!workspace.has_parent(current)) break;
+        current = workspace.get_parent(current);
+    }
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
 bool PathExtractor::isValidPath(const std::vector<Point*>& path) {
     // Placeholder - à implémenter
     return !path.empty();
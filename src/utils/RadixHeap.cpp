@@ -0,0 +1,117 @@
+#include "utils/RadixHeap.hpp"
+#include <cstring>
+#include <stdexcept>
+
+RadixHeap::RadixHeap() : last_key(0), count(0) {}
+
+void RadixHeap::resize(long long cell_count)
+{
+    if (cell_count < 0 || cell_count >= static_cast<long long>(NOT_IN_HEAP)) {
+        throw std::length_error("RadixHeap::resize: cell_count exceeds 32-bit positions.");
+    }
+    for (auto& bucket : buckets) bucket.clear();
+    bucket_of.assign(static_cast<size_t>(cell_count), 0);
+    slot_of.assign(static_cast<size_t>(cell_count), NOT_IN_HEAP);
+    last_key = 0;
+    count = 0;
+}
+
+void RadixHeap::clear()
+{
+    for (auto& bucket : buckets) {
+        for (const FrontEntry& entry : bucket) slot_of[entry.index] = NOT_IN_HEAP;
+        bucket.clear();
+    }
+    last_key = 0;
+    count = 0;
+}
+
+std::uint32_t RadixHeap::key_bits(float key)
+{
+    if (!(key > 0.0f)) return 0; // 0, -0 et clés négatives
+    std::uint32_t bits;
+    std::memcpy(&bits, &key, sizeof(bits));
+    return bits;
+}
+
+int RadixHeap::bucket_for(std::uint32_t bits) const
+{
+    if (bits <= last_key) return 0;
+    int bucket = 0;
+    for (std::uint32_t diff = bits ^ last_key; diff != 0; diff >>= 1) bucket++;
+    return bucket;
+}
+
+void RadixHeap::insert(long long index, float key) const
+{
+    std::vector<FrontEntry>& bucket = buckets[bucket_for(key_bits(key))];
+    bucket_of[index] = static_cast<std::uint8_t>(&bucket - buckets);
+    slot_of[index] = static_cast<std::uint32_t>(bucket.size());
+    bucket.push_back({key, index});
+}
+
+void RadixHeap::remove(long long index)
+{
+    std::vector<FrontEntry>& bucket = buckets[bucket_of[index]];
+    std::uint32_t slot = slot_of[index];
+    bucket[slot] = bucket.back();
+    slot_of[bucket[slot].index] = slot;
+    bucket.pop_back();
+    slot_of[index] = NOT_IN_HEAP;
+    count--;
+}
+
+void RadixHeap::refill() const
+{
+    if (!buckets[0].empty()) return;
+
+    int first = 1;
+    while (buckets[first].empty()) first++;
+
+    // La nouvelle référence est la plus petite clé du premier seau non vide
+    std::vector<FrontEntry> moved;
+    moved.swap(buckets[first]);
+    std::uint32_t min_key = key_bits(moved[0].value);
+    for (const FrontEntry& entry : moved) {
+        std::uint32_t bits = key_bits(entry.value);
+        if (bits < min_key) min_key = bits;
+    }
+    last_key = min_key;
+    for (const FrontEntry& entry : moved) insert(entry.index, entry.value);
+
+    // Réutiliser la capacité du seau vidé
+    moved.clear();
+    if (buckets[first].capacity() < moved.capacity()) buckets[first].swap(moved);
+}
+
+FrontEntry RadixHeap::top() const
+{
+    refill();
+    return buckets[0].back();
+}
+
+FrontEntry RadixHeap::pop()
+{
+    FrontEntry entry = top();
+    remove(entry.index);
+    return entry;
+}
+
+bool RadixHeap::push(long long index, float key)
+{
+    if (index < 0 || index >= capacity()) {
+        throw std::out_of_range("RadixHeap::push: index outside of the grid.");
+    }
+
+    bool inserted = slot_of[index] == NOT_IN_HEAP;
+    if (!inserted) remove(index);
+    insert(index, key);
+    count++;
+    return inserted;
+}
+
+void RadixHeap::erase(long long index)
+{
+    if (slot_of[index] == NOT_IN_HEAP) return;
+    remove(index);
+}
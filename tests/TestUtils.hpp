@@ -0,0 +1,67 @@
+#ifndef TESTUTILS_HPP
+#define TESTUTILS_HPP
+
+#include "Environnement.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Outils communs aux tests : vérification, coût de référence, validation de chemin
+ */
+
+inline void check(bool condition, const std::string& message)
+{
+    if (!condition) throw std::runtime_error(message);
+}
+
+/**
+ * @brief Coût optimal de référence : Dijkstra complet depuis source, valeur en target
+ * @param neighborhood Voisinage de la recherche (nullptr pour le voisinage par défaut)
+ */
+inline float reference_cost(Environnement& env, NeighborhoodStrategy* neighborhood,
+                            const std::vector<float>& source, const std::vector<float>& target)
+{
+    Dijkstra dijkstra(&env);
+    dijkstra.set_verbose(false);
+    dijkstra.set_neighborhood(neighborhood);
+    dijkstra.add_start(source);
+    dijkstra.execute();
+    return dijkstra.get_value(target);
+}
+
+/**
+ * @brief Vérifie qu'un chemin relie start à goal par des cellules libres voisines (bords
+ * périodiques compris), sans passer deux fois par la même cellule
+ * @param axial_only Seuls les pas le long d'un axe sont admis
+ * @return Longueur euclidienne du chemin (nombre de pas si axial_only)
+ */
+inline float check_path(const Environnement& env, const std::vector<long long>& path, long long start, long long goal,
+                        bool axial_only = false)
+{
+    check(!path.empty() && path.front() == start && path.back() == goal, "Le chemin doit relier départ et arrivée");
+    const GridShape& shape = env.get_shape();
+    std::unordered_set<long long> visited = {path.front()};
+    float length = 0.0f;
+    for (size_t k = 1; k < path.size(); k++) {
+        check(!env.is_obstacle(path[k]), "Le chemin traverse un obstacle");
+        check(visited.insert(path[k]).second, "Cellule répétée dans le chemin");
+        int squared = 0;
+        for (int axis = 0; axis < shape.get_dim(); axis++) {
+            int delta = std::abs(shape.coord(path[k], axis) - shape.coord(path[k - 1], axis));
+            if (env.is_periodic(axis)) delta = std::min(delta, shape.size(axis) - delta);
+            check(delta <= 1, "Deux cellules consécutives du chemin ne sont pas voisines");
+            squared += delta * delta;
+        }
+        check(!axial_only || squared == 1, "Pas diagonal dans un chemin axial");
+        length += std::sqrt(static_cast<float>(squared));
+    }
+    return length;
+}
+
+#endif // TESTUTILS_HPP
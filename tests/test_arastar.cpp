@@ -0,0 +1,167 @@
+#include "Environnement.hpp"
+#include "algorithms/graph/AStar.hpp"
+#include "algorithms/graph/ARAStar.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/neighbors/GridNeighbors.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <chrono>
+#include <cmath>
+
+/**
+ * @brief Recherche par tranches de temps : chaque solution intermédiaire respecte sa borne,
+ * coût et borne ne font que diminuer, la dernière solution est optimale
+ * @return Nombre de solutions intermédiaires distinctes
+ */
+template <typename Heuristic>
+static int run_anytime(Environnement& env, NeighborhoodStrategy* neighborhood, Heuristic h,
+                       const std::vector<float>& start, const std::vector<float>& goal)
+{
+    float optimal = reference_cost(env, neighborhood, start, goal);
+    check(!std::isinf(optimal), "Arrivée inaccessible");
+
+    ARAStar<Heuristic> planner(&env, 1.0f, h, 3.0f, 0.5f);
+    planner.set_verbose(false);
+    planner.set_neighborhood(neighborhood);
+    planner.add_start(start);
+    planner.add_end(goal);
+
+    float last_cost = std::numeric_limits<float>::infinity();
+    float last_bound = std::numeric_limits<float>::infinity();
+    int solutions = 0;
+    for (int slice = 0; slice < 100000 && !planner.is_finished(); slice++) {
+        const std::vector<long long>& path = planner.plan_for(std::chrono::microseconds(50));
+        if (path.empty()) continue;
+        float cost = planner.get_path_cost();
+        float bound = planner.get_suboptimality_bound();
+        check(cost <= last_cost && bound <= last_bound, "Coût et borne ne doivent jamais augmenter");
+        check(cost <= bound * optimal + 1e-3f, "Coût " + std::to_string(cost) + " au-delà de la borne " +
+                                                   std::to_string(bound) + " x " + std::to_string(optimal));
+        check(std::abs(check_path(env, path, env.index_of(start), env.index_of(goal)) - cost) < 1e-3f,
+              "La longueur du chemin doit égaler son coût");
+        if (cost < last_cost) solutions++;
+        last_cost = cost;
+        last_bound = bound;
+    }
+    check(planner.is_finished(), "La recherche doit se terminer");
+    check(std::abs(planner.get_path_cost() - optimal) < 1e-3f, "La solution finale doit être optimale");
+    check(planner.get_suboptimality_bound() == 1.0f, "Borne finale attendue : 1");
+    return solutions;
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests ARA* ===" << std::endl;
+
+        // Test 1: Solutions intermédiaires bornées, 4-connexe et 8-connexe
+        std::cout << "\n--- Test 1: Recherche par tranches de temps ---" << std::endl;
+        Environnement env = Environnement::createRandomEnvironment({150, 150}, 0.25, 13, Environnement::DENSE);
+        env.set_obs(env.index_of({2.0f, 3.0f}), false);
+        env.set_obs(env.index_of({146.0f, 140.0f}), false);
+        int solutions = run_anytime(env, nullptr, ManhattanDistance(), {2.0f, 3.0f}, {146.0f, 140.0f});
+        std::cout << "4-connexe : " << solutions << " solutions successives, optimum atteint" << std::endl;
+        GridNeighbors full(GridNeighbors::FULL);
+        solutions = run_anytime(env, &full, OctileDistance(), {2.0f, 3.0f}, {146.0f, 140.0f});
+        std::cout << "8-connexe : " << solutions << " solutions successives, optimum atteint" << std::endl;
+
+        // Heuristique choisie à l'exécution, comme AStar
+        EuclideanHeuristic euclidean;
+        euclidean.set_environment(&env);
+        solutions = run_anytime(env, nullptr, StrategyHeuristic{&euclidean, &env}, {2.0f, 3.0f}, {146.0f, 140.0f});
+        std::cout << "StrategyHeuristic : " << solutions << " solutions successives" << std::endl;
+
+        // Test 2: Échéance dépassée puis reprise
+        std::cout << "\n--- Test 2: Échéance et reprise ---" << std::endl;
+        ARAStar<ManhattanDistance> planner(&env);
+        planner.set_verbose(false);
+        planner.add_start({2.0f, 3.0f});
+        planner.add_end({146.0f, 140.0f});
+        check(planner.plan(ARAStar<ManhattanDistance>::Clock::now()).empty(), "Aucun chemin avant toute expansion");
+        check(std::isinf(planner.get_suboptimality_bound()), "Borne infinie sans solution");
+        planner.plan(ARAStar<ManhattanDistance>::Clock::time_point::max());
+        check(planner.is_finished(), "La reprise doit terminer la recherche");
+        float optimal = reference_cost(env, nullptr, {2.0f, 3.0f}, {146.0f, 140.0f});
+        check(std::abs(planner.get_path_cost() - optimal) < 1e-3f, "La reprise doit atteindre l'optimum");
+        std::cout << "Reprise après échéance : optimum atteint en " << planner.get_iterations() << " itérations" << std::endl;
+
+        // Test 3: Réutilisation de l'effort vs recherches pondérées indépendantes
+        std::cout << "\n--- Test 3: Réutilisation de l'effort ---" << std::endl;
+        Environnement open = Environnement::createRandomEnvironment({400, 400}, 0.15, 21, Environnement::DENSE);
+        open.set_obs(open.index_of({5.0f, 5.0f}), false);
+        open.set_obs(open.index_of({390.0f, 380.0f}), false);
+        ARAStar<ManhattanDistance> anytime(&open, 1.0f, ManhattanDistance(), 3.0f, 0.5f);
+        anytime.set_verbose(false);
+        anytime.add_start({5.0f, 5.0f});
+        anytime.add_end({390.0f, 380.0f});
+        auto t0 = std::chrono::high_resolution_clock::now();
+        anytime.execute();
+        auto t1 = std::chrono::high_resolution_clock::now();
+
+        long long independent = 0;
+        long long first_solution = 0;
+        for (float weight = 3.0f; weight >= 1.0f; weight -= 0.5f) {
+            StaticAStar<ManhattanDistance> weighted(&open, 1.0f, ManhattanDistance{weight});
+            weighted.set_verbose(false);
+            weighted.add_start({5.0f, 5.0f});
+            weighted.add_end({390.0f, 380.0f});
+            weighted.execute();
+            independent += weighted.get_statistics().expansions;
+            if (weight == 3.0f) first_solution = weighted.get_statistics().expansions;
+        }
+        StaticAStar<ManhattanDistance> exact(&open);
+        exact.set_verbose(false);
+        exact.add_start({5.0f, 5.0f});
+        exact.add_end({390.0f, 380.0f});
+        exact.execute();
+        check(std::abs(anytime.get_path_cost() - exact.get_value({390.0f, 380.0f})) < 1e-3f, "ARA* doit finir optimal");
+        check(anytime.get_statistics().expansions < independent, "ARA* doit réutiliser l'effort des itérations");
+        std::cout << "ARA* complet: " << anytime.get_statistics().expansions << " expansions en "
+                  << anytime.get_iterations() << " itérations, "
+                  << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        std::cout << "Recherches pondérées indépendantes: " << independent << " expansions" << std::endl;
+        std::cout << "Première solution (epsilon 3): " << first_solution << " expansions, A* exact: "
+                  << exact.get_statistics().expansions << std::endl;
+
+        // Test 4: Paramètres refusés
+        std::cout << "\n--- Test 4: Paramètres refusés ---" << std::endl;
+        bool rejected = false;
+        try {
+            ARAStar<ManhattanDistance> invalid(&env, 1.0f, ManhattanDistance(), 0.5f);
+        } catch (const std::invalid_argument&) {
+            rejected = true;
+        }
+        check(rejected, "Un epsilon < 1 doit être refusé");
+        rejected = false;
+        try {
+            ARAStar<ManhattanDistance> floating(&env);
+            floating.add_start({2.0f, 3.0f});
+            floating.add_end({10.5f, 10.5f});
+            floating.execute();
+        } catch (const std::invalid_argument&) {
+            rejected = true;
+        }
+        check(rejected, "Une arrivée flottante doit être refusée");
+        rejected = false;
+        try {
+            ARAStar<ManhattanDistance> buckets(&env);
+            buckets.set_queue_policy(DIAL_BUCKETS);
+            buckets.add_start({2.0f, 3.0f});
+            buckets.add_end({146.0f, 140.0f});
+            buckets.execute();
+        } catch (const std::logic_error&) {
+            rejected = true;
+        }
+        check(rejected, "Une frontière à seaux doit être refusée");
+        std::cout << "Epsilon < 1, arrivée flottante et seaux refusés" << std::endl;
+
+        std::cout << "\n=== Tests ARA* terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test ARA*: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
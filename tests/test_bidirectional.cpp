@@ -0,0 +1,123 @@
+#include "Environnement.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/StaticAStar.hpp"
+#include "algorithms/graph/BidirectionalAStar.hpp"
+#include "algorithms/graph/neighbors/GridNeighbors.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <cmath>
+
+int main() {
+    try {
+        std::cout << "=== Tests Recherche bidirectionnelle ===" << std::endl;
+
+        Environnement open = Environnement::createRandomEnvironment({300, 300}, 0.25, 7, Environnement::DENSE);
+        Environnement maze = Environnement::createMazeEnvironment({121, 121}, 3, Environnement::DENSE);
+        open.set_obs(open.index_of({10.0f, 10.0f}), false);
+        maze.set_obs(maze.index_of({0.0f, 0.0f}), false);
+
+        // Test 1: Dijkstra bidirectionnel = Dijkstra, moins d'expansions qu'une recherche arrêtée au but
+        std::cout << "\n--- Test 1: Dijkstra bidirectionnel ---" << std::endl;
+        struct Query { Environnement* env; std::vector<float> start; const char* name; };
+        for (const Query& query : {Query{&open, {10.0f, 10.0f}, "aléatoire"}, Query{&maze, {0.0f, 0.0f}, "labyrinthe"}}) {
+            Dijkstra reference(query.env);
+            reference.add_start(query.start);
+            reference.execute();
+
+            // But : la cellule atteignable la plus proche du coin opposé
+            const GridShape& shape = query.env->get_shape();
+            long long goal = -1;
+            int best_distance = 0;
+            for (long long index = 0; index < shape.get_total(); index++) {
+                if (std::isinf(reference.get_workspace().get_value(index))) continue;
+                int distance = (shape.size(0) - 1 - shape.coord(index, 0)) + (shape.size(1) - 1 - shape.coord(index, 1));
+                if (goal < 0 || distance < best_distance) {
+                    goal = index;
+                    best_distance = distance;
+                }
+            }
+            std::vector<float> goal_coords = {static_cast<float>(shape.coord(goal, 0)), static_cast<float>(shape.coord(goal, 1))};
+            float optimal = reference.get_value(goal_coords);
+
+            StaticAStar<ZeroDistance> unidirectional(query.env);
+            unidirectional.add_start(query.start);
+            unidirectional.add_end(goal_coords);
+            unidirectional.execute();
+
+            BidirectionalDijkstra bidirectional(query.env);
+            bidirectional.add_start(query.start);
+            bidirectional.add_end(goal_coords);
+            bidirectional.execute();
+
+            check(bidirectional.get_path_cost() == optimal, std::string("Coût bidirectionnel incorrect sur ") + query.name);
+            float length = check_path(*query.env, bidirectional.extract_path(), query.env->index_of(query.start), goal);
+            check(length == optimal, "La longueur du chemin doit égaler le coût");
+
+            long long uni = unidirectional.get_statistics().expansions;
+            long long bi = bidirectional.get_statistics().expansions;
+            std::cout << query.name << " : coût " << optimal << ", expansions unidirectionnelles " << uni
+                      << ", bidirectionnelles " << bi << std::endl;
+            check(bi < uni, "Le Dijkstra bidirectionnel doit développer moins de cellules");
+        }
+
+        // Test 2: A* bidirectionnel (potentiels moyens) sur plusieurs requêtes 8-connexes
+        std::cout << "\n--- Test 2: A* bidirectionnel 8-connexe ---" << std::endl;
+        GridNeighbors full(GridNeighbors::FULL);
+        const std::vector<std::vector<float>> goals = {{290.0f, 280.0f}, {150.0f, 20.0f}, {35.0f, 260.0f}, {11.0f, 10.0f}};
+        for (const auto& goal_coords : goals) {
+            open.set_obs(open.index_of(goal_coords), false);
+
+            Dijkstra reference(&open);
+            reference.set_neighborhood(&full);
+            reference.add_start({10.0f, 10.0f});
+            reference.execute();
+            float optimal = reference.get_value(goal_coords);
+
+            StaticAStar<EuclideanDistance> unidirectional(&open);
+            unidirectional.set_neighborhood(&full);
+            unidirectional.add_start({10.0f, 10.0f});
+            unidirectional.add_end(goal_coords);
+            unidirectional.execute();
+
+            BidirectionalAStar<EuclideanDistance> bidirectional(&open);
+            bidirectional.set_neighborhood(&full);
+            bidirectional.add_start({10.0f, 10.0f});
+            bidirectional.add_end(goal_coords);
+            bidirectional.execute();
+
+            check(std::abs(bidirectional.get_path_cost() - optimal) < 1e-3f, "A* bidirectionnel non optimal");
+            float length = check_path(open, bidirectional.extract_path(), open.index_of({10.0f, 10.0f}), open.index_of(goal_coords));
+            check(std::abs(length - optimal) < 1e-3f, "La longueur du chemin doit égaler le coût");
+            std::cout << "(" << goal_coords[0] << ", " << goal_coords[1] << ") : coût " << optimal
+                      << ", A* " << unidirectional.get_statistics().expansions
+                      << " expansions, bidirectionnel " << bidirectional.get_statistics().expansions << std::endl;
+        }
+
+        // Test 3: But inaccessible et départ = arrivée
+        std::cout << "\n--- Test 3: Cas limites ---" << std::endl;
+        Environnement walled = Environnement::createRandomEnvironment({20, 20}, 0.0, 1, Environnement::DENSE);
+        for (int y = 0; y < 20; y++) walled.set_obs(walled.index_of({10.0f, static_cast<float>(y)}), true);
+        BidirectionalAStar<ManhattanDistance> blocked(&walled);
+        blocked.add_start({2.0f, 2.0f});
+        blocked.add_end({17.0f, 17.0f});
+        blocked.execute();
+        check(std::isinf(blocked.get_path_cost()) && blocked.extract_path().empty(), "Aucun chemin attendu à travers le mur");
+
+        BidirectionalDijkstra same(&walled);
+        same.add_start({4.0f, 5.0f});
+        same.add_end({4.0f, 5.0f});
+        same.execute();
+        check(same.get_path_cost() == 0.0f && same.extract_path().size() == 1, "Départ = arrivée : coût nul");
+        std::cout << "Cas limites OK" << std::endl;
+
+        std::cout << "\n=== Tests Recherche bidirectionnelle terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test Recherche bidirectionnelle: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
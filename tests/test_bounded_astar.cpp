@@ -0,0 +1,139 @@
+#include "Environnement.hpp"
+#include "algorithms/graph/AStar.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/neighbors/GridNeighbors.hpp"
+#include "utils/PathExtractor.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <chrono>
+#include <cmath>
+
+static const char* mode_name(SuboptimalityMode mode)
+{
+    switch (mode) {
+        case WEIGHTED_ASTAR: return "pondéré";
+        case DYNAMIC_WEIGHTING: return "poids dynamique";
+        case FOCAL_SEARCH: return "focal";
+        default: return "optimal";
+    }
+}
+
+/**
+ * @brief Chaque mode et chaque facteur : coût <= w * optimal, chemin valide
+ * @return Expansions par (mode, facteur), affichées
+ */
+template <typename Heuristic>
+static void check_modes(Environnement& env, NeighborhoodStrategy* neighborhood, Heuristic h,
+                        const std::vector<float>& start, const std::vector<float>& goal)
+{
+    float optimal = reference_cost(env, neighborhood, start, goal);
+    check(!std::isinf(optimal), "Arrivée inaccessible");
+
+    long long optimal_expansions = 0;
+    for (auto mode : {OPTIMAL_SEARCH, WEIGHTED_ASTAR, DYNAMIC_WEIGHTING, FOCAL_SEARCH}) {
+        std::cout << mode_name(mode) << " :";
+        for (float factor : {1.0f, 1.05f, 1.5f, 3.0f}) {
+            StaticAStar<Heuristic> astar(&env, 1.0f, h);
+            astar.set_verbose(false);
+            astar.set_neighborhood(neighborhood);
+            astar.set_suboptimality(mode, factor);
+            astar.add_start(start);
+            astar.add_end(goal);
+            astar.execute();
+
+            float cost = astar.get_value(goal);
+            float bound = astar.get_suboptimality_bound();
+            check(bound == (mode == OPTIMAL_SEARCH ? 1.0f : factor), "Borne rapportée incorrecte");
+            check(cost <= bound * optimal + 1e-3f, std::string(mode_name(mode)) + " : coût " + std::to_string(cost) +
+                                                       " au-delà de " + std::to_string(bound) + " x " + std::to_string(optimal));
+            check(std::abs(check_path(env, PathExtractor::extractPath(astar.get_workspace(), env.index_of(goal)),
+                                       env.index_of(start), env.index_of(goal)) - cost) < 1e-3f,
+                  "La longueur du chemin doit égaler son coût");
+            if (factor == 1.0f) {
+                check(std::abs(cost - optimal) < 1e-3f, "Un facteur 1 doit donner l'optimum");
+                if (mode == OPTIMAL_SEARCH) optimal_expansions = astar.get_statistics().expansions;
+            }
+            std::cout << " w=" << factor << " " << astar.get_statistics().expansions << " exp. (+"
+                      << 100.0f * (cost - optimal) / optimal << " %)";
+        }
+        std::cout << std::endl;
+    }
+    check(optimal_expansions > 0, "A* optimal non exécuté");
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests A* sous-optimal borné ===" << std::endl;
+
+        // Test 1: Bornes respectées, 4-connexe et 8-connexe
+        std::cout << "\n--- Test 1: Bornes de coût ---" << std::endl;
+        Environnement env = Environnement::createRandomEnvironment({200, 200}, 0.25, 19, Environnement::DENSE);
+        env.set_obs(env.index_of({3.0f, 4.0f}), false);
+        env.set_obs(env.index_of({195.0f, 190.0f}), false);
+        check_modes(env, nullptr, ManhattanDistance(), {3.0f, 4.0f}, {195.0f, 190.0f});
+        GridNeighbors full(GridNeighbors::FULL);
+        check_modes(env, &full, OctileDistance(), {3.0f, 4.0f}, {195.0f, 190.0f});
+
+        // Test 2: Gain sur une carte ouverte, AStar avec stratégie à l'exécution
+        std::cout << "\n--- Test 2: Carte ouverte ---" << std::endl;
+        Environnement open = Environnement::createRandomEnvironment({600, 600}, 0.1, 27, Environnement::DENSE);
+        open.set_obs(open.index_of({10.0f, 20.0f}), false);
+        open.set_obs(open.index_of({590.0f, 560.0f}), false);
+        float optimal = reference_cost(open, nullptr, {10.0f, 20.0f}, {590.0f, 560.0f});
+        ManhattanHeuristic manhattan;
+        long long optimal_expansions = 0;
+        for (auto mode : {OPTIMAL_SEARCH, WEIGHTED_ASTAR, DYNAMIC_WEIGHTING, FOCAL_SEARCH}) {
+            AStar astar(&open, 1.0f, &manhattan);
+            astar.set_verbose(false);
+            astar.set_suboptimality(mode, 1.1f);
+            astar.add_start({10.0f, 20.0f});
+            astar.add_end({590.0f, 560.0f});
+            auto t0 = std::chrono::high_resolution_clock::now();
+            astar.execute();
+            auto t1 = std::chrono::high_resolution_clock::now();
+            float cost = astar.get_value({590.0f, 560.0f});
+            check(cost <= astar.get_suboptimality_bound() * optimal + 1e-3f, "Borne de coût dépassée");
+            long long expansions = astar.get_statistics().expansions;
+            if (mode == OPTIMAL_SEARCH) optimal_expansions = expansions;
+            else if (mode == WEIGHTED_ASTAR) check(expansions * 10 < optimal_expansions, "w = 1.1 doit réduire fortement les expansions");
+            std::cout << mode_name(mode) << " (w=1.1) : " << expansions << " expansions, coût +"
+                      << 100.0f * (cost - optimal) / optimal << " %, "
+                      << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        }
+
+        // Test 3: Paramètres refusés
+        std::cout << "\n--- Test 3: Paramètres refusés ---" << std::endl;
+        bool rejected = false;
+        try {
+            AStar astar(&env, 1.0f, &manhattan);
+            astar.set_suboptimality(WEIGHTED_ASTAR, 0.9f);
+        } catch (const std::invalid_argument&) {
+            rejected = true;
+        }
+        check(rejected, "Un facteur < 1 doit être refusé");
+        rejected = false;
+        try {
+            AStar astar(&env, 1.0f, &manhattan);
+            astar.set_verbose(false);
+            astar.set_queue_policy(DIAL_BUCKETS);
+            astar.set_suboptimality(WEIGHTED_ASTAR, 2.0f);
+            astar.add_start({3.0f, 4.0f});
+            astar.add_end({195.0f, 190.0f});
+            astar.execute();
+        } catch (const std::logic_error&) {
+            rejected = true;
+        }
+        check(rejected, "Des clés pondérées dans des seaux doivent être refusées");
+        std::cout << "Facteur < 1 et seaux pondérés refusés" << std::endl;
+
+        std::cout << "\n=== Tests A* sous-optimal borné terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test A* sous-optimal borné: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
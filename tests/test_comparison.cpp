@@ -0,0 +1,362 @@
+#include "Environnement.hpp"
+#include "PeriodicEnvironnement.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/AStar.hpp"
+#include "algorithms/graph/FMM.hpp"
+#include "algorithms/graph/StaticAStar.hpp"
+#include "algorithms/graph/neighbors/GridNeighbors.hpp"
+#include "utils/IndexedHeap.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <random>
+#include <deque>
+#include <memory>
+#include <cmath>
+#include <chrono>
+
+#ifndef OUTPUT_DIR
+#define OUTPUT_DIR ""
+#endif
+
+static void print_statistics(const std::string& name, const SearchStatistics& stats)
+{
+    std::cout << name << " - expansions: " << stats.expansions << ", insertions: " << stats.pushes
+              << ", extractions: " << stats.pops << ", decrease-key: " << stats.decrease_keys << std::endl;
+}
+
+/**
+ * @brief Distances de référence par parcours en largeur (coût unitaire, voisins axiaux)
+ */
+static std::vector<float> bfs_distances(const Environnement& env, long long start)
+{
+    std::vector<float> distances(env.get_shape().get_total(), INFINITY);
+    std::deque<long long> queue;
+    distances[start] = 0.0f;
+    queue.push_back(start);
+    long long neighbors[Environnement::MAX_AXIS_NEIGHBORS];
+    while (!queue.empty()) {
+        long long current = queue.front();
+        queue.pop_front();
+        int count = env.get_neigh(current, neighbors);
+        for (int k = 0; k < count; k++) {
+            long long next = neighbors[k];
+            if (env.is_obstacle(next) || !std::isinf(distances[next])) continue;
+            distances[next] = distances[current] + 1.0f;
+            queue.push_back(next);
+        }
+    }
+    return distances;
+}
+
+template <typename Search>
+static double timed_execute(Search& search)
+{
+    auto t0 = std::chrono::high_resolution_clock::now();
+    search.execute();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+/**
+ * @brief Plus grand écart absolu entre deux champs de valeurs (cellules atteintes)
+ */
+static float max_difference(const SearchWorkspace& a, const SearchWorkspace& b)
+{
+    float difference = 0.0f;
+    for (long long index = 0; index < a.size(); index++) {
+        float va = a.get_value(index), vb = b.get_value(index);
+        if (std::isinf(va) || std::isinf(vb)) {
+            if (std::isinf(va) != std::isinf(vb)) return INFINITY;
+            continue;
+        }
+        difference = std::max(difference, std::abs(va - vb));
+    }
+    return difference;
+}
+
+static const char* policy_name(QueuePolicy policy)
+{
+    switch (policy) {
+        case DARY_HEAP: return "tas 4-aire";
+        case DIAL_BUCKETS: return "seaux de Dial";
+        case RADIX_HEAP: return "tas radix";
+        case UNTIDY_BUCKETS: return "seaux untidy";
+    }
+    return "?";
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests Comparaison (frontière) ===" << std::endl;
+
+        // Test 1: Tas indexé contre un tri de référence
+        std::cout << "\n--- Test 1: Tas indexé ---" << std::endl;
+        {
+            const long long count = 2000;
+            IndexedHeap heap;
+            heap.resize(count);
+            std::vector<float> keys(count, INFINITY);
+            std::mt19937 gen(3);
+            std::uniform_real_distribution<float> dis(0.0f, 1000.0f);
+            std::uniform_int_distribution<long long> pick(0, count - 1);
+
+            for (int k = 0; k < 10000; k++) {
+                long long index = pick(gen);
+                float key = dis(gen);
+                if (!heap.contains(index) || key < keys[index]) {
+                    heap.push(index, key);
+                    keys[index] = key;
+                }
+            }
+            for (long long index = 0; index < count; index += 7) {
+                heap.erase(index);
+                keys[index] = INFINITY;
+            }
+
+            std::vector<float> expected;
+            for (float key : keys) if (!std::isinf(key)) expected.push_back(key);
+            std::sort(expected.begin(), expected.end());
+            check(heap.size() == expected.size(), "Taille du tas incorrecte");
+
+            for (float key : expected) {
+                FrontEntry entry = heap.pop();
+                check(entry.value == key && keys[entry.index] == key, "Ordre d'extraction incorrect");
+            }
+            check(heap.empty(), "Le tas doit être vide");
+            std::cout << expected.size() << " extractions dans l'ordre" << std::endl;
+        }
+
+        // Test 2: Dijkstra sur labyrinthe, une seule expansion par cellule
+        std::cout << "\n--- Test 2: Dijkstra sur labyrinthe ---" << std::endl;
+        Environnement maze = Environnement::createMazeEnvironment({201, 151}, 5, Environnement::DENSE);
+        long long start = maze.index_of({0.0f, 0.0f});
+        std::vector<float> reference = bfs_distances(maze, start);
+        long long reachable = std::count_if(reference.begin(), reference.end(), [](float d) { return !std::isinf(d); });
+
+        Dijkstra dijkstra(&maze);
+        dijkstra.add_start({0.0f, 0.0f});
+        dijkstra.execute();
+        for (long long index = 0; index < static_cast<long long>(reference.size()); index++) {
+            check(dijkstra.get_workspace().get_value(index) == reference[index], "Dijkstra diffère du parcours en largeur");
+        }
+        const SearchStatistics& dijkstra_stats = dijkstra.get_statistics();
+        print_statistics("Dijkstra", dijkstra_stats);
+        check(dijkstra_stats.expansions == reachable, "Chaque cellule atteignable doit être développée une seule fois");
+        check(dijkstra_stats.pops == dijkstra_stats.pushes, "Une extraction par insertion");
+
+        // Test 3: Carte aléatoire (nombreux decrease-key) et FMM
+        std::cout << "\n--- Test 3: Carte aléatoire ---" << std::endl;
+        Environnement random_env = Environnement::createRandomEnvironment({200, 200}, 0.25, 11, Environnement::DENSE);
+        FMM fmm(&random_env);
+        fmm.add_start({100.0f, 100.0f});
+        fmm.execute();
+        const SearchStatistics& fmm_stats = fmm.get_statistics();
+        print_statistics("FMM", fmm_stats);
+        check(fmm_stats.pops == fmm_stats.pushes && fmm_stats.expansions == fmm_stats.pops,
+              "FMM: chaque cellule est extraite une seule fois");
+        check(fmm_stats.decrease_keys > 0, "FMM doit diminuer des clés en cours de propagation");
+
+        // But atteignable le plus proche du coin (199, 199)
+        long long goal = random_env.get_shape().get_total() - 1;
+        while (std::isinf(fmm.get_workspace().get_value(goal))) goal--;
+        Cell goal_cell = random_env.cell(goal);
+
+        EuclideanHeuristic euclidean(1.0f);
+        AStar astar(&random_env, 1.0f, &euclidean);
+        astar.add_start({100.0f, 100.0f});
+        astar.add_end({static_cast<float>(goal_cell.coord(0)), static_cast<float>(goal_cell.coord(1))});
+        astar.execute();
+        print_statistics("A*", astar.get_statistics());
+        check(astar.get_statistics().expansions > 0, "A* doit développer des cellules");
+        check(astar.get_statistics().pops == astar.get_statistics().expansions, "A*: une expansion par extraction");
+
+        // Test 4: Politiques de file pour Dijkstra (4 et 8 voisins) : champs identiques
+        std::cout << "\n--- Test 4: Politiques de file (Dijkstra) ---" << std::endl;
+        Environnement large = Environnement::createRandomEnvironment({400, 400}, 0.2, 21, Environnement::DENSE);
+        large.set_obs(large.index_of({200.0f, 200.0f}), false);
+        GridNeighbors full(GridNeighbors::FULL);
+        const QueuePolicy exact_policies[] = {DARY_HEAP, DIAL_BUCKETS, RADIX_HEAP};
+        for (int connectivity = 0; connectivity < 2; connectivity++) {
+            Dijkstra reference_search(&large);
+            if (connectivity == 1) reference_search.set_neighborhood(&full);
+            reference_search.add_start({200.0f, 200.0f});
+            reference_search.execute();
+            for (QueuePolicy policy : exact_policies) {
+                Dijkstra search(&large);
+                if (connectivity == 1) search.set_neighborhood(&full);
+                search.set_queue_policy(policy);
+                search.add_start({200.0f, 200.0f});
+                double time = timed_execute(search);
+                float difference = max_difference(reference_search.get_workspace(), search.get_workspace());
+                std::cout << (connectivity == 0 ? "4" : "8") << "-connexe, " << policy_name(policy)
+                          << ": " << time << " ms, écart max " << difference << std::endl;
+                check(difference < 1e-3f, "Dijkstra doit être exact avec chaque politique");
+                check(search.get_statistics().expansions == reference_search.get_statistics().expansions,
+                      "Même nombre d'expansions attendu");
+            }
+        }
+
+        // Test 5: FMM avec chaque politique (untidy : écart borné)
+        std::cout << "\n--- Test 5: Politiques de file (FMM) ---" << std::endl;
+        FMM fmm_reference(&large);
+        fmm_reference.add_start({200.0f, 200.0f});
+        fmm_reference.execute();
+        const QueuePolicy fmm_policies[] = {DARY_HEAP, RADIX_HEAP, UNTIDY_BUCKETS};
+        for (QueuePolicy policy : fmm_policies) {
+            FMM search(&large);
+            search.set_queue_policy(policy);
+            search.add_start({200.0f, 200.0f});
+            double time = timed_execute(search);
+            float difference = max_difference(fmm_reference.get_workspace(), search.get_workspace());
+            std::cout << "FMM, " << policy_name(policy) << ": " << time << " ms, écart max " << difference << std::endl;
+            float tolerance = policy == UNTIDY_BUCKETS ? 1.0f : 1e-3f;
+            check(difference < tolerance, "Écart FMM trop grand");
+        }
+
+        // Test 6: Boucles à dimension fixe (2D / 3D) contre la boucle générique
+        std::cout << "\n--- Test 6: Noyaux 2D / 3D ---" << std::endl;
+        Environnement env3d = Environnement::createRandomEnvironment({60, 60, 60}, 0.2, 8, Environnement::DENSE);
+        env3d.set_obs(env3d.index_of({30.0f, 30.0f, 30.0f}), false);
+        auto torus = PeriodicEnvironnement::createPeriodicRandomEnvironment({300, 200}, {true, false}, 0.2, 4,
+                                                                            Environnement::DENSE);
+        torus->set_obs(torus->index_of({0.0f, 100.0f}), false);
+
+        struct KernelCase { Environnement* env; std::vector<float> start; const char* name; };
+        const KernelCase cases[] = {
+            {&large, {200.0f, 200.0f}, "2D"},
+            {&env3d, {30.0f, 30.0f, 30.0f}, "3D"},
+            {torus.get(), {0.0f, 100.0f}, "2D périodique"},
+        };
+        for (const KernelCase& test_case : cases) {
+            for (int algorithm = 0; algorithm < 2; algorithm++) {
+                std::unique_ptr<GraphSearchBase> generic, fixed;
+                if (algorithm == 0) {
+                    generic = std::make_unique<Dijkstra>(test_case.env);
+                    fixed = std::make_unique<Dijkstra>(test_case.env);
+                } else {
+                    generic = std::make_unique<FMM>(test_case.env);
+                    fixed = std::make_unique<FMM>(test_case.env);
+                }
+                generic->set_fixed_dimension_kernels(false);
+                generic->add_start(test_case.start);
+                fixed->add_start(test_case.start);
+                double t_generic = timed_execute(*generic);
+                double t_fixed = timed_execute(*fixed);
+
+                float difference = max_difference(generic->get_workspace(), fixed->get_workspace());
+                std::cout << (algorithm == 0 ? "Dijkstra " : "FMM ") << test_case.name << " - générique: " << t_generic
+                          << " ms, dimension fixe: " << t_fixed << " ms, écart max " << difference << std::endl;
+                check(difference == 0.0f, "Le noyau à dimension fixe doit donner des valeurs identiques");
+                check(generic->get_statistics().expansions == fixed->get_statistics().expansions,
+                      "Même nombre d'expansions attendu");
+            }
+        }
+
+        // Test 7: A* à heuristique statique / virtuelle : coût optimal = Dijkstra
+        std::cout << "\n--- Test 7: A* statique vs virtuel ---" << std::endl;
+        Environnement astar_map = Environnement::createRandomEnvironment({400, 400}, 0.2, 21, Environnement::MAP);
+        astar_map.set_obs(astar_map.index_of({200.0f, 200.0f}), false);
+        long long astar_goal = large.get_shape().get_total() - 1;
+        while (std::isinf(fmm_reference.get_workspace().get_value(astar_goal))) astar_goal--;
+        Cell astar_goal_cell = large.cell(astar_goal);
+        std::vector<float> goal_coords = {static_cast<float>(astar_goal_cell.coord(0)),
+                                          static_cast<float>(astar_goal_cell.coord(1))};
+
+        Dijkstra dijkstra_reference(&large);
+        dijkstra_reference.add_start({200.0f, 200.0f});
+        dijkstra_reference.execute();
+        float optimal = dijkstra_reference.get_value(goal_coords);
+
+        for (Environnement* astar_env : {&large, &astar_map}) {
+            const char* backend = astar_env == &large ? "DENSE" : "MAP";
+            ManhattanHeuristic manhattan(1.0f);
+            AStar virtual_astar(astar_env, 1.0f, &manhattan);
+            virtual_astar.add_start({200.0f, 200.0f});
+            virtual_astar.add_end(goal_coords);
+            double t_virtual = timed_execute(virtual_astar);
+
+            StaticAStar<ManhattanDistance> static_astar(astar_env);
+            static_astar.add_start({200.0f, 200.0f});
+            static_astar.add_end(goal_coords);
+            double t_static = timed_execute(static_astar);
+
+            StaticAStar<MaxOf<ManhattanDistance, EuclideanDistance>> combined_astar(astar_env);
+            combined_astar.add_start({200.0f, 200.0f});
+            combined_astar.add_end(goal_coords);
+            combined_astar.execute();
+
+            std::cout << backend << " - A* virtuel: " << t_virtual << " ms, A* statique: " << t_static
+                      << " ms, coût " << static_astar.get_value(goal_coords) << " (Dijkstra: " << optimal << ")" << std::endl;
+            check(virtual_astar.get_value(goal_coords) == optimal, "A* virtuel doit trouver le coût optimal");
+            check(static_astar.get_value(goal_coords) == optimal, "A* statique doit trouver le coût optimal");
+            check(combined_astar.get_value(goal_coords) == optimal, "A* MaxOf doit trouver le coût optimal");
+            check(max_difference(virtual_astar.get_workspace(), static_astar.get_workspace()) == 0.0f &&
+                  virtual_astar.get_statistics().expansions == static_astar.get_statistics().expansions,
+                  "A* statique et virtuel doivent explorer les mêmes cellules");
+            check(static_astar.get_statistics().expansions < dijkstra_reference.get_statistics().expansions,
+                  "A* doit développer moins de cellules que Dijkstra");
+        }
+
+        // Test 8: Politiques de file pour A* (8 voisins, heuristique euclidienne) : coût de Dijkstra
+        std::cout << "\n--- Test 8: Politiques de file (A*) ---" << std::endl;
+        const QueuePolicy astar_policies[] = {DARY_HEAP, RADIX_HEAP};
+        int astar_runs = 0;
+        for (int seed = 0; seed < 30; seed++) {
+            Environnement map = Environnement::createRandomEnvironment({120, 120}, 0.25, 100 + seed, Environnement::DENSE);
+            map.set_obs(map.index_of({5.0f, 5.0f}), false);
+            map.set_obs(map.index_of({114.0f, 110.0f}), false);
+            Dijkstra reference_search(&map);
+            reference_search.set_verbose(false);
+            reference_search.set_neighborhood(&full);
+            reference_search.add_start({5.0f, 5.0f});
+            reference_search.execute();
+            float reference_cost = reference_search.get_value({114.0f, 110.0f});
+            if (std::isinf(reference_cost)) continue;
+            for (QueuePolicy policy : astar_policies) {
+                for (SuboptimalityMode mode : {OPTIMAL_SEARCH, FOCAL_SEARCH}) {
+                    AStar search(&map, 1.0f, &euclidean);
+                    search.set_verbose(false);
+                    search.set_neighborhood(&full);
+                    search.set_queue_policy(policy);
+                    search.set_suboptimality(mode, 1.1f);
+                    search.add_start({5.0f, 5.0f});
+                    search.add_end({114.0f, 110.0f});
+                    search.execute();
+                    float cost = search.get_value({114.0f, 110.0f});
+                    float bound = mode == OPTIMAL_SEARCH ? reference_cost : 1.1f * reference_cost;
+                    check(cost >= reference_cost - 1e-3f && cost <= bound + 1e-3f,
+                          std::string("A* ") + policy_name(policy) + " : coût " + std::to_string(cost) +
+                              " au lieu de " + std::to_string(reference_cost));
+                }
+            }
+            astar_runs++;
+        }
+        check(astar_runs > 0, "Au moins une carte doit relier le départ et l'arrivée");
+        for (QueuePolicy policy : {DIAL_BUCKETS, UNTIDY_BUCKETS}) {
+            bool rejected = false;
+            try {
+                AStar search(&large, 1.0f, &euclidean);
+                search.set_verbose(false);
+                search.set_queue_policy(policy);
+                search.add_start({200.0f, 200.0f});
+                search.add_end(goal_coords);
+                search.execute();
+            } catch (const std::logic_error&) {
+                rejected = true;
+            }
+            check(rejected, std::string("A* doit refuser les ") + policy_name(policy));
+        }
+        std::cout << astar_runs << " cartes : coût de Dijkstra avec tas binaire et tas radix, seaux refusés" << std::endl;
+
+        std::cout << "\n=== Tests Comparaison terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test Comparaison: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
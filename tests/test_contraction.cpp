@@ -0,0 +1,194 @@
+#include "Environnement.hpp"
+#include "PeriodicEnvironnement.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/ContractionHierarchy.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifndef OUTPUT_DIR
+#define OUTPUT_DIR ""
+#endif
+
+/**
+ * @brief Compare CH et Dijkstra sur des paires aléatoires
+ * @return Nombre moyen de nœuds établis par requête CH
+ */
+static double compare_with_dijkstra(Environnement& env, const ContractionHierarchy& hierarchy, int queries, unsigned seed)
+{
+    CHQuery query(&hierarchy);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> random_node(0, hierarchy.get_node_count() - 1);
+    long long settled = 0;
+    for (int q = 0; q < queries; q++) {
+        long long source = hierarchy.get_cell(random_node(rng));
+        long long target = hierarchy.get_cell(random_node(rng));
+
+        Dijkstra reference(&env);
+        reference.set_verbose(false);
+        reference.add_start(env.cell(source).get_coords());
+        reference.execute();
+        float expected = reference.get_workspace().get_value(target);
+
+        float cost = query.distance(source, target);
+        settled += query.get_settled();
+        check(std::isinf(cost) == std::isinf(expected), "CH et Dijkstra ne s'accordent pas sur l'accessibilité");
+        if (std::isinf(cost)) continue;
+        check(std::abs(cost - expected) < 1e-3f,
+              "Distance CH " + std::to_string(cost) + " au lieu de " + std::to_string(expected));
+        check(check_path(env, query.get_path(), source, target, true) == std::round(cost),
+              "La longueur du chemin développé doit égaler la distance");
+    }
+    return static_cast<double>(settled) / queries;
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests Contraction Hierarchies ===" << std::endl;
+
+        // Test 1: Distances exactes sur carte aléatoire et labyrinthe, deux backends
+        std::cout << "\n--- Test 1: CH vs Dijkstra ---" << std::endl;
+        for (auto backend : {Environnement::DENSE, Environnement::MAP}) {
+            Environnement random_map = Environnement::createRandomEnvironment({100, 80}, 0.25, 21, backend);
+            Environnement maze = Environnement::createMazeEnvironment({81, 61}, 5, backend);
+            for (Environnement* env : {&random_map, &maze}) {
+                ContractionHierarchy hierarchy(env);
+                hierarchy.build();
+                double settled = compare_with_dijkstra(*env, hierarchy, 40, 3);
+                std::cout << (backend == Environnement::DENSE ? "DENSE" : "MAP") << " : " << hierarchy.get_node_count()
+                          << " nœuds, " << hierarchy.get_shortcut_count() << " raccourcis, " << settled
+                          << " nœuds établis par requête" << std::endl;
+            }
+        }
+
+        // Test 2: Bords périodiques
+        std::cout << "\n--- Test 2: Carte périodique ---" << std::endl;
+        auto torus = PeriodicEnvironnement::createPeriodicMazeEnvironment({41, 31}, {true, false}, 7, Environnement::DENSE);
+        ContractionHierarchy torus_hierarchy(torus.get());
+        torus_hierarchy.build();
+        compare_with_dijkstra(*torus, torus_hierarchy, 30, 5);
+        std::cout << "Distances exactes à travers le bord périodique" << std::endl;
+
+        // Test 3: Sauvegarde / rechargement
+        std::cout << "\n--- Test 3: Sauvegarde ---" << std::endl;
+        Environnement env = Environnement::createRandomEnvironment({200, 200}, 0.2, 8, Environnement::DENSE);
+        ContractionHierarchy built(&env);
+        auto t0 = std::chrono::high_resolution_clock::now();
+        built.build();
+        auto t1 = std::chrono::high_resolution_clock::now();
+        std::string filename = std::string(OUTPUT_DIR) + "contraction.ch";
+        built.save(filename);
+
+        ContractionHierarchy loaded(&env);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        loaded.load(filename);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        check(loaded.get_arc_count() == built.get_arc_count(), "Nombre d'arcs différent après rechargement");
+
+        CHQuery built_query(&built), loaded_query(&loaded);
+        std::mt19937 rng(11);
+        std::uniform_int_distribution<int> random_node(0, built.get_node_count() - 1);
+        for (int q = 0; q < 200; q++) {
+            long long source = built.get_cell(random_node(rng));
+            long long target = built.get_cell(random_node(rng));
+            check(built_query.distance(source, target) == loaded_query.distance(source, target),
+                  "Réponse différente après rechargement");
+            check(built_query.get_path() == loaded_query.get_path(), "Chemin différent après rechargement");
+        }
+        std::cout << "Construction: " << std::chrono::duration<double, std::milli>(t1 - t0).count()
+                  << " ms, rechargement: " << std::chrono::duration<double, std::milli>(t3 - t2).count() << " ms" << std::endl;
+
+        Environnement other = Environnement::createRandomEnvironment({200, 200}, 0.2, 9, Environnement::DENSE);
+        ContractionHierarchy mismatch(&other);
+        bool rejected = false;
+        try {
+            mismatch.load(filename);
+        } catch (const std::runtime_error&) {
+            rejected = true;
+        }
+        check(rejected, "Une hiérarchie calculée sur une autre carte doit être refusée");
+
+        // Fichiers corrompus : chaque champ modifié doit être refusé
+        std::string original;
+        {
+            std::ifstream input(filename, std::ios::binary);
+            original.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+        }
+        using Arc = ContractionHierarchy::Arc;
+        size_t nodes = built.get_node_count();
+        size_t arcs_offset = original.size() - built.get_arc_count() * sizeof(Arc);
+        size_t first_offset = arcs_offset - (nodes + 1) * sizeof(int);
+        size_t rank_offset = first_offset - nodes * sizeof(int);
+        size_t arc_count_offset = rank_offset - nodes * sizeof(std::int64_t) - 2 * sizeof(std::int64_t);
+        auto expect_corrupted = [&](size_t offset, const auto& value, const std::string& label) {
+            std::string corrupted = original;
+            std::memcpy(&corrupted[offset], &value, sizeof(value));
+            std::string corrupted_name = std::string(OUTPUT_DIR) + "contraction_corrupted.ch";
+            std::ofstream(corrupted_name, std::ios::binary) << corrupted;
+            bool corrupted_rejected = false;
+            try {
+                ContractionHierarchy damaged(&env);
+                damaged.load(corrupted_name);
+            } catch (const std::runtime_error&) {
+                corrupted_rejected = true;
+            }
+            check(corrupted_rejected, "Fichier corrompu accepté : " + label);
+        };
+        int first_rank;
+        std::memcpy(&first_rank, &original[rank_offset], sizeof(int));
+        expect_corrupted(arc_count_offset, std::int64_t(-1), "nombre d'arcs négatif");
+        expect_corrupted(arc_count_offset, std::int64_t(1) << 40, "nombre d'arcs démesuré");
+        expect_corrupted(rank_offset + sizeof(int), first_rank, "rang dupliqué");
+        expect_corrupted(first_offset + nodes * sizeof(int), static_cast<int>(built.get_arc_count()) - 1, "dernier offset");
+        expect_corrupted(first_offset + sizeof(int), static_cast<int>(built.get_arc_count()) + 1, "offsets décroissants");
+        expect_corrupted(arcs_offset + offsetof(Arc, target), static_cast<int>(nodes), "cible hors bornes");
+        expect_corrupted(arcs_offset + offsetof(Arc, middle), static_cast<int>(nodes), "nœud contourné hors bornes");
+        std::cout << "Hiérarchie d'une autre carte et fichiers corrompus refusés" << std::endl;
+
+        // Test 4: Temps de requête CH vs Dijkstra
+        std::cout << "\n--- Test 4: Temps de requête ---" << std::endl;
+        const int queries = 200;
+        std::vector<std::pair<long long, long long>> pairs;
+        for (int q = 0; q < queries; q++) pairs.push_back({built.get_cell(random_node(rng)), built.get_cell(random_node(rng))});
+
+        auto d0 = std::chrono::high_resolution_clock::now();
+        long long dijkstra_expansions = 0;
+        for (int q = 0; q < 10; q++) {
+            Dijkstra dijkstra(&env);
+            dijkstra.set_verbose(false);
+            dijkstra.add_start(env.cell(pairs[q].first).get_coords());
+            dijkstra.execute();
+            dijkstra_expansions += dijkstra.get_statistics().expansions;
+        }
+        auto d1 = std::chrono::high_resolution_clock::now();
+        long long ch_settled = 0;
+        for (const auto& pair : pairs) {
+            loaded_query.distance(pair.first, pair.second);
+            ch_settled += loaded_query.get_settled();
+        }
+        auto d2 = std::chrono::high_resolution_clock::now();
+
+        double dijkstra_ms = std::chrono::duration<double, std::milli>(d1 - d0).count() / 10;
+        double ch_ms = std::chrono::duration<double, std::milli>(d2 - d1).count() / queries;
+        check(ch_settled / queries * 10 < dijkstra_expansions / 10, "La requête CH doit établir bien moins de nœuds");
+        std::cout << "Dijkstra: " << dijkstra_ms << " ms, " << dijkstra_expansions / 10 << " expansions par requête" << std::endl;
+        std::cout << "CH: " << ch_ms << " ms, " << ch_settled / queries << " nœuds établis par requête" << std::endl;
+
+        std::cout << "\n=== Tests Contraction Hierarchies terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test Contraction Hierarchies: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,284 @@
+#include "Environnement.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/FMM.hpp"
+#include "algorithms/graph/FastSweeping.hpp"
+#include "algorithms/graph/FastIterativeMethod.hpp"
+#include "algorithms/graph/IncrementalFMM.hpp"
+#include "algorithms/graph/IncrementalDijkstra.hpp"
+#include "algorithms/graph/StaticAStar.hpp"
+#include "algorithms/graph/BidirectionalAStar.hpp"
+#include "algorithms/graph/DStarLite.hpp"
+#include "TestUtils.hpp"
+#include <stb/stb_image_write.h>
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <fstream>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <algorithm>
+
+#ifndef OUTPUT_DIR
+#define OUTPUT_DIR ""
+#endif
+
+/**
+ * @brief Compare deux champs : même accessibilité, écart relatif borné
+ */
+static void compare_fields(const SearchWorkspace& actual, const SearchWorkspace& expected, float max_error,
+                           const std::string& label)
+{
+    for (long long index = 0; index < expected.size(); index++) {
+        float a = actual.get_value(index), b = expected.get_value(index);
+        check(std::isinf(a) == std::isinf(b), label + " : accessibilité différente en " + std::to_string(index));
+        if (std::isinf(a)) continue;
+        check(std::abs(a - b) <= max_error * std::max(1.0f, b),
+              label + " : " + std::to_string(a) + " au lieu de " + std::to_string(b) + " en " + std::to_string(index));
+    }
+}
+
+/**
+ * @brief Terrain aléatoire lisse par blocs : coûts entre 1 et 4
+ */
+static std::vector<float> random_terrain(const Environnement& env, int block, unsigned int seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> cost(1.0f, 4.0f);
+    const GridShape& shape = env.get_shape();
+    std::vector<float> block_costs(shape.get_total());
+    for (auto& value : block_costs) value = cost(rng);
+    std::vector<float> costs(shape.get_total());
+    for (long long index = 0; index < shape.get_total(); index++) {
+        long long block_index = 0;
+        for (int axis = 0; axis < shape.get_dim(); axis++) block_index += (shape.coord(index, axis) / block) * shape.stride(axis);
+        costs[index] = block_costs[block_index];
+    }
+    return costs;
+}
+
+template <typename Solver>
+static void run(Solver& solver, const std::vector<float>& start)
+{
+    solver.set_verbose(false);
+    solver.add_start(start);
+    solver.execute();
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests champ de coût ===" << std::endl;
+
+        // Test 1: Champ uniforme : équivalent au coût scalaire
+        std::cout << "\n--- Test 1: Champ uniforme ---" << std::endl;
+        Environnement env = Environnement::createRandomEnvironment({60, 50}, 0.2, 7, Environnement::DENSE);
+        env.set_obs(env.index_of({30.0f, 25.0f}), false);
+        FMM fmm_scalar(&env, 2.0f);
+        Dijkstra dijkstra_scalar(&env, 2.0f);
+        run(fmm_scalar, {30.0f, 25.0f});
+        run(dijkstra_scalar, {30.0f, 25.0f});
+        env.set_cost_field(std::vector<float>(env.get_shape().get_total(), 2.0f));
+        FMM fmm_field(&env);
+        Dijkstra dijkstra_field(&env);
+        run(fmm_field, {30.0f, 25.0f});
+        run(dijkstra_field, {30.0f, 25.0f});
+        compare_fields(fmm_field.get_workspace(), fmm_scalar.get_workspace(), 1e-6f, "FMM uniforme");
+        compare_fields(dijkstra_field.get_workspace(), dijkstra_scalar.get_workspace(), 1e-6f, "Dijkstra uniforme");
+        check(env.get_min_cost() == 2.0f, "Coût minimal attendu : 2");
+        std::cout << "Champ uniforme à 2 identique au coût scalaire 2" << std::endl;
+
+        // Test 2: Deux terrains le long d'un couloir : valeurs exactes
+        std::cout << "\n--- Test 2: Couloir à deux terrains ---" << std::endl;
+        Environnement corridor(Environnement::DENSE);
+        corridor.set_dims({100, 20});
+        for (long long index = 0; index < corridor.get_shape().get_total(); index++) {
+            corridor.set_cost(index, corridor.get_shape().coord(index, 0) < 50 ? 1.0f : 3.0f);
+        }
+        FMM fmm(&corridor);
+        Dijkstra dijkstra(&corridor);
+        run(fmm, {0.0f, 10.0f});
+        run(dijkstra, {0.0f, 10.0f});
+        // FMM : chaque cellule coûte son propre coût ; Dijkstra : moyenne des deux extrémités de l'arête
+        check(std::abs(fmm.get_value({99.0f, 10.0f}) - (49.0f + 50.0f * 3.0f)) < 1e-3f, "Valeur FMM incorrecte");
+        check(std::abs(dijkstra.get_value({99.0f, 10.0f}) - (49.0f + 2.0f + 49.0f * 3.0f)) < 1e-3f, "Valeur Dijkstra incorrecte");
+        std::cout << "FMM " << fmm.get_value({99.0f, 10.0f}) << ", Dijkstra " << dijkstra.get_value({99.0f, 10.0f}) << std::endl;
+
+        // Test 3: Terrain aléatoire : solveurs Eikonal concordants, boucles spécialisées et seaux exacts
+        std::cout << "\n--- Test 3: Terrain aléatoire ---" << std::endl;
+        for (auto dims : {std::vector<int>{90, 70}, std::vector<int>{30, 24, 20}}) {
+            Environnement terrain = Environnement::createRandomEnvironment(dims, 0.1, 3, Environnement::DENSE);
+            std::vector<float> start(dims.size());
+            for (size_t axis = 0; axis < dims.size(); axis++) start[axis] = static_cast<float>(dims[axis] / 2);
+            terrain.set_obs(terrain.index_of(start), false);
+            terrain.set_cost_field(random_terrain(terrain, 6, 11));
+            const std::string label = std::to_string(dims.size()) + "D";
+
+            FMM reference(&terrain), generic(&terrain);
+            FastSweeping sweeping(&terrain);
+            FastIterativeMethod fim(&terrain);
+            generic.set_fixed_dimension_kernels(false);
+            run(reference, start);
+            run(generic, start);
+            run(sweeping, start);
+            run(fim, start);
+            compare_fields(generic.get_workspace(), reference.get_workspace(), 0.0f, label + " FMM générique");
+            compare_fields(sweeping.get_workspace(), reference.get_workspace(), 1e-4f, label + " balayage");
+            compare_fields(fim.get_workspace(), reference.get_workspace(), 1e-4f, label + " FIM");
+
+            Dijkstra heap(&terrain), buckets(&terrain), loop(&terrain);
+            buckets.set_queue_policy(DIAL_BUCKETS);
+            loop.set_fixed_dimension_kernels(false);
+            run(heap, start);
+            run(buckets, start);
+            run(loop, start);
+            compare_fields(loop.get_workspace(), heap.get_workspace(), 0.0f, label + " Dijkstra générique");
+            compare_fields(buckets.get_workspace(), heap.get_workspace(), 1e-5f, label + " Dijkstra seaux");
+            std::cout << label << " : FMM, balayage et FIM concordants ; Dijkstra tas, seaux et boucle générique identiques"
+                      << std::endl;
+        }
+
+        // Test 4: Calculs incrémentaux : un nouveau champ relance un calcul complet, des coûts
+        // de cellules modifiés sont réparés par Dijkstra incrémental
+        std::cout << "\n--- Test 4: Calculs incrémentaux ---" << std::endl;
+        Environnement dynamic = Environnement::createRandomEnvironment({50, 50}, 0.15, 5, Environnement::DENSE);
+        dynamic.set_obs(dynamic.index_of({25.0f, 25.0f}), false);
+        IncrementalFMM incremental_fmm(&dynamic);
+        IncrementalDijkstra incremental_dijkstra(&dynamic);
+        run(incremental_fmm, {25.0f, 25.0f});
+        run(incremental_dijkstra, {25.0f, 25.0f});
+        dynamic.set_cost_field(random_terrain(dynamic, 5, 17));
+        incremental_fmm.execute();
+        incremental_dijkstra.execute();
+        check(!incremental_fmm.was_incremental() && !incremental_dijkstra.was_incremental(),
+              "Un nouveau champ de coût doit relancer un calcul complet");
+        FMM fresh_fmm(&dynamic);
+        Dijkstra fresh_dijkstra(&dynamic);
+        run(fresh_fmm, {25.0f, 25.0f});
+        run(fresh_dijkstra, {25.0f, 25.0f});
+        compare_fields(incremental_fmm.get_workspace(), fresh_fmm.get_workspace(), 0.0f, "FMM incrémental");
+        compare_fields(incremental_dijkstra.get_workspace(), fresh_dijkstra.get_workspace(), 0.0f, "Dijkstra incrémental");
+
+        // Coûts modifiés cellule par cellule : Dijkstra incrémental répare
+        std::mt19937 cost_rng(23);
+        std::uniform_int_distribution<int> random_cell(0, static_cast<int>(dynamic.get_shape().get_total()) - 1);
+        std::uniform_real_distribution<float> random_cost(0.5f, 6.0f);
+        for (int round = 0; round < 10; round++) {
+            std::vector<long long> changed;
+            for (int k = 0; k < 5; k++) {
+                long long cell = random_cell(cost_rng);
+                dynamic.set_cost(cell, random_cost(cost_rng));
+                changed.push_back(cell);
+            }
+            incremental_dijkstra.update_cells(changed);
+            incremental_dijkstra.execute();
+            check(incremental_dijkstra.was_incremental(), "Des coûts de cellules modifiés doivent être réparés");
+            Dijkstra reference(&dynamic);
+            run(reference, {25.0f, 25.0f});
+            compare_fields(incremental_dijkstra.get_workspace(), reference.get_workspace(), 1e-5f,
+                           "Dijkstra réparé, tour " + std::to_string(round));
+        }
+        std::cout << "Champ modifié : calculs complets, valeurs identiques ; coûts de cellules réparés" << std::endl;
+
+        // Test 5: Chargement PNG et fichier brut, erreurs
+        std::cout << "\n--- Test 5: Chargement ---" << std::endl;
+        Environnement image_env(Environnement::DENSE);
+        image_env.set_dims({16, 8});
+        std::vector<unsigned char> pixels(16 * 8);
+        for (int y = 0; y < 8; y++) {
+            for (int x = 0; x < 16; x++) pixels[y * 16 + x] = static_cast<unsigned char>(x < 8 ? 255 : 0);
+        }
+        const std::string png = std::string(OUTPUT_DIR) + "cost_field.png";
+        const bool png_written = stbi_write_png(png.c_str(), 16, 8, 1, pixels.data(), 16) != 0;
+        check(png_written, "Écriture de l'image de coûts impossible: " + png);
+        image_env.load_costs_from_png(png, 1.0f, 5.0f);
+        check(image_env.get_cost(image_env.index_of({2.0f, 3.0f})) == 1.0f &&
+              image_env.get_cost(image_env.index_of({12.0f, 3.0f})) == 5.0f, "Coûts PNG incorrects");
+
+        const std::string raw = std::string(OUTPUT_DIR) + "cost_field.raw";
+        std::vector<float> written = random_terrain(image_env, 3, 2);
+        {
+            std::ofstream file(raw, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(written.data()), written.size() * sizeof(float));
+        }
+        image_env.load_costs_from_raw(raw);
+        for (long long index = 0; index < image_env.get_shape().get_total(); index++) {
+            check(image_env.get_cost(index) == written[index], "Coûts bruts incorrects");
+        }
+
+        int rejected = 0;
+        try {
+            image_env.set_cost(0, 0.0f);
+        } catch (const std::invalid_argument&) {
+            rejected++;
+        }
+        try {
+            image_env.set_cost_field(std::vector<float>(3, 1.0f));
+        } catch (const std::invalid_argument&) {
+            rejected++;
+        }
+        try {
+            image_env.load_costs_from_png(png, 5.0f, 1.0f);
+        } catch (const std::invalid_argument&) {
+            rejected++;
+        }
+        try {
+            corridor.load_costs_from_png(png, 1.0f, 5.0f);
+        } catch (const std::invalid_argument&) {
+            rejected++;
+        }
+        try {
+            corridor.load_costs_from_raw(raw);
+        } catch (const std::runtime_error&) {
+            rejected++;
+        }
+        check(rejected == 5,
+              "Coût nul, taille de champ, coûts extrêmes, taille d'image et taille de fichier doivent être refusés");
+
+        // Recherches à coût d'arête uniforme : refusées plutôt que de donner d'autres coûts que Dijkstra
+        StaticAStar<ManhattanDistance> astar(&image_env);
+        BidirectionalDijkstra bidirectional(&image_env);
+        DStarLite<ManhattanDistance> dstar(&image_env);
+        int unsupported = 0;
+        for (GraphSearchBase* search : {static_cast<GraphSearchBase*>(&astar), static_cast<GraphSearchBase*>(&bidirectional),
+                                        static_cast<GraphSearchBase*>(&dstar)}) {
+            search->set_verbose(false);
+            search->add_start({1.0f, 1.0f});
+            search->add_end({14.0f, 6.0f});
+            try {
+                search->execute();
+            } catch (const std::logic_error&) {
+                unsupported++;
+            }
+        }
+        check(unsupported == 3, "A*, A* bidirectionnel et D* Lite doivent refuser un champ de coût");
+        image_env.clear_cost_field();
+        check(!image_env.has_cost_field() && image_env.get_cost(5) == 1.0f, "Retour au coût uniforme attendu");
+        std::cout << "Fichier brut et PNG chargés, entrées invalides et recherches à coût uniforme refusées" << std::endl;
+
+        // Test 6: Surcoût du champ sur une grande carte
+        std::cout << "\n--- Test 6: Surcoût ---" << std::endl;
+        Environnement large = Environnement::createRandomEnvironment({800, 800}, 0.1, 9, Environnement::DENSE);
+        large.set_obs(large.index_of({400.0f, 400.0f}), false);
+        for (bool with_field : {false, true}) {
+            if (with_field) large.set_cost_field(random_terrain(large, 20, 4));
+            FMM timed_fmm(&large);
+            Dijkstra timed_dijkstra(&large);
+            auto t0 = std::chrono::high_resolution_clock::now();
+            run(timed_fmm, {400.0f, 400.0f});
+            auto t1 = std::chrono::high_resolution_clock::now();
+            run(timed_dijkstra, {400.0f, 400.0f});
+            auto t2 = std::chrono::high_resolution_clock::now();
+            std::cout << (with_field ? "Avec champ" : "Sans champ") << " : FMM "
+                      << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, Dijkstra "
+                      << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms" << std::endl;
+        }
+
+        std::cout << "\n=== Tests champ de coût terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test champ de coût: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+#include "Environnement.hpp"
+#include "PeriodicEnvironnement.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/DStarLite.hpp"
+#include "algorithms/graph/neighbors/GridNeighbors.hpp"
+#include "algorithms/graph/neighbors/EuclideanNeighbors.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <chrono>
+#include <random>
+#include <cmath>
+
+/**
+ * @brief Le robot avance sur son chemin en découvrant des changements aléatoires autour de lui ;
+ * chaque réparation est comparée à un Dijkstra complet
+ * @return Nombre de réparations vérifiées
+ */
+template <typename Heuristic>
+static int run_mission(Environnement& env, NeighborhoodStrategy* neighborhood, Heuristic h,
+                       std::vector<float> robot, const std::vector<float> goal, unsigned seed)
+{
+    const GridShape& shape = env.get_shape();
+    DStarLite<Heuristic> planner(&env, 1.0f, h);
+    planner.set_verbose(false);
+    planner.set_neighborhood(neighborhood);
+    planner.add_start(robot);
+    planner.add_end(goal);
+    planner.execute();
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> offset(-4, 4);
+    long long goal_index = env.index_of(goal);
+    int repairs = 0;
+    for (int step = 0; step < 40; step++) {
+        float expected = reference_cost(env, neighborhood, goal, robot);
+        float cost = planner.get_path_cost();
+        check(std::isinf(cost) == std::isinf(expected), "D* Lite et Dijkstra ne s'accordent pas sur l'accessibilité");
+        if (std::isinf(cost)) break;
+        check(std::abs(cost - expected) < 1e-3f,
+              "Coût D* Lite " + std::to_string(cost) + " au lieu de " + std::to_string(expected));
+        std::vector<long long> path = planner.extract_path();
+        check(std::abs(check_path(env, path, env.index_of(robot), goal_index) - cost) < 1e-3f,
+              "La longueur du chemin doit égaler le coût");
+        repairs++;
+        if (path.size() < 3) break;
+
+        // Un pas sur le chemin, puis des cellules changent autour du robot
+        robot = env.cell(path[1]).get_coords();
+        planner.move_to(robot);
+        std::vector<long long> changed;
+        for (int k = 0; k < 3; k++) {
+            std::vector<float> coords = robot;
+            for (int axis = 0; axis < shape.get_dim(); axis++) {
+                int c = static_cast<int>(coords[axis]) + offset(rng);
+                coords[axis] = static_cast<float>(std::min(std::max(c, 0), shape.size(axis) - 1));
+            }
+            long long cell = env.index_of(coords);
+            if (cell < 0 || cell == env.index_of(robot) || cell == goal_index) continue;
+            env.set_obs(cell, !env.is_obstacle(cell));
+            changed.push_back(cell);
+        }
+        planner.update_cells(changed);
+        planner.replan();
+    }
+    return repairs;
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests D* Lite ===" << std::endl;
+
+        // Test 1: Réparations exactes, 4-connexe, backends DENSE et MAP
+        std::cout << "\n--- Test 1: Robot sur carte changeante ---" << std::endl;
+        for (auto backend : {Environnement::DENSE, Environnement::MAP}) {
+            Environnement env = Environnement::createRandomEnvironment({60, 50}, 0.2, 5, backend);
+            env.set_obs(env.index_of({2.0f, 2.0f}), false);
+            env.set_obs(env.index_of({57.0f, 46.0f}), false);
+            int repairs = run_mission(env, nullptr, ManhattanDistance(), {2.0f, 2.0f}, {57.0f, 46.0f}, 3);
+            std::cout << (backend == Environnement::DENSE ? "DENSE" : "MAP") << " : "
+                      << repairs << " réparations identiques à Dijkstra" << std::endl;
+        }
+
+        // Test 2: 8-connexe et carte périodique
+        std::cout << "\n--- Test 2: 8-connexe et périodique ---" << std::endl;
+        Environnement open = Environnement::createRandomEnvironment({50, 50}, 0.15, 12, Environnement::DENSE);
+        open.set_obs(open.index_of({1.0f, 48.0f}), false);
+        open.set_obs(open.index_of({47.0f, 3.0f}), false);
+        GridNeighbors full(GridNeighbors::FULL);
+        int repairs = run_mission(open, &full, OctileDistance(), {1.0f, 48.0f}, {47.0f, 3.0f}, 8);
+        std::cout << "8-connexe : " << repairs << " réparations identiques à Dijkstra" << std::endl;
+
+        auto torus = PeriodicEnvironnement::createPeriodicMazeEnvironment({41, 31}, {true, true}, 4, Environnement::DENSE);
+        torus->set_obs(torus->index_of({1.0f, 1.0f}), false);
+        torus->set_obs(torus->index_of({39.0f, 29.0f}), false);
+        repairs = run_mission(*torus, nullptr, ManhattanDistance(), {1.0f, 1.0f}, {39.0f, 29.0f}, 2);
+        std::cout << "Tore : " << repairs << " réparations identiques à Dijkstra" << std::endl;
+
+        // Test 3: Coût d'une réparation locale vs replanification complète
+        std::cout << "\n--- Test 3: Latence de réparation ---" << std::endl;
+        Environnement large = Environnement::createRandomEnvironment({400, 400}, 0.2, 17, Environnement::DENSE);
+        large.set_obs(large.index_of({5.0f, 5.0f}), false);
+        large.set_obs(large.index_of({390.0f, 395.0f}), false);
+        DStarLite<ManhattanDistance> planner(&large);
+        planner.set_verbose(false);
+        planner.add_start({5.0f, 5.0f});
+        planner.add_end({390.0f, 395.0f});
+        auto t0 = std::chrono::high_resolution_clock::now();
+        planner.execute();
+        auto t1 = std::chrono::high_resolution_clock::now();
+        long long full_expansions = planner.get_statistics().expansions;
+        check(!std::isinf(planner.get_path_cost()), "Arrivée inaccessible");
+
+        // Mur découvert en travers du chemin, juste devant le robot
+        std::vector<long long> path = planner.extract_path();
+        std::vector<float> center = large.cell(path[6]).get_coords();
+        std::vector<long long> blocked;
+        for (int dx = -2; dx <= 2; dx++) {
+            for (int dy = -2; dy <= 2; dy++) {
+                long long cell = large.index_of({center[0] + dx, center[1] + dy});
+                if (cell < 0 || large.is_obstacle(cell)) continue;
+                large.set_obs(cell, true);
+                blocked.push_back(cell);
+            }
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        planner.update_cells(blocked);
+        planner.replan();
+        auto t3 = std::chrono::high_resolution_clock::now();
+        long long repair_expansions = planner.get_statistics().expansions;
+        float repaired = planner.get_path_cost();
+        check(std::abs(repaired - reference_cost(large, nullptr, {390.0f, 395.0f}, {5.0f, 5.0f})) < 1e-3f,
+              "Coût réparé incorrect");
+        check(repair_expansions * 10 < full_expansions, "La réparation doit rester locale");
+        std::cout << "Planification: " << full_expansions << " expansions, "
+                  << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        std::cout << "Réparation: " << repair_expansions << " expansions, "
+                  << std::chrono::duration<double, std::milli>(t3 - t2).count() << " ms" << std::endl;
+
+        // Test 4: Configurations refusées
+        std::cout << "\n--- Test 4: Configurations refusées ---" << std::endl;
+        EuclideanNeighbors n16(std::sqrt(5.0f));
+        DStarLite<EuclideanDistance> swept(&open);
+        swept.set_verbose(false);
+        swept.set_neighborhood(&n16);
+        swept.add_start({1.0f, 48.0f});
+        swept.add_end({47.0f, 3.0f});
+        bool rejected = false;
+        try {
+            swept.execute();
+        } catch (const std::logic_error&) {
+            rejected = true;
+        }
+        check(rejected, "Un voisinage à cellules traversées doit être refusé");
+
+        DStarLite<ZeroDistance> unplanned(&open);
+        rejected = false;
+        try {
+            unplanned.replan();
+        } catch (const std::logic_error&) {
+            rejected = true;
+        }
+        check(rejected, "replan() avant execute() doit être refusé");
+        std::cout << "Voisinage euclidien et replan() prématuré refusés" << std::endl;
+
+        std::cout << "\n=== Tests D* Lite terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test D* Lite: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include "Point.hpp"
+#include "Environnement.hpp"
+#include "PeriodicEnvironnement.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/FMM.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <chrono>
+#include <cmath>
+
+#ifndef OUTPUT_DIR
+#define OUTPUT_DIR ""
+#endif
+
+/**
+ * @brief Compare les valeurs U de deux recherches cellule par cellule
+ * @return Nombre de cellules comparées
+ */
+static int compare_values(const GraphSearchBase& a, const GraphSearchBase& b, const std::vector<int>& dims)
+{
+    int compared = 0;
+    for (int x = 0; x < dims[0]; x++) {
+        for (int y = 0; y < dims[1]; y++) {
+            std::vector<float> coords = {static_cast<float>(x), static_cast<float>(y)};
+            float va = a.get_value(coords);
+            float vb = b.get_value(coords);
+            if (std::isinf(va) != std::isinf(vb) || (!std::isinf(va) && std::abs(va - vb) > 1e-4f)) {
+                throw std::runtime_error("Valeurs différentes en (" + std::to_string(x) + ", " + std::to_string(y) +
+                                         "): " + std::to_string(va) + " vs " + std::to_string(vb));
+            }
+            compared++;
+        }
+    }
+    return compared;
+}
+
+template <typename Search>
+static double timed_execute(Search& search)
+{
+    auto t0 = std::chrono::high_resolution_clock::now();
+    search.execute();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests Environnement (backends MAP / DENSE) ===" << std::endl;
+
+        // Test 1: Même graine -> même carte quel que soit le backend
+        std::cout << "\n--- Test 1: Cohérence des factories ---" << std::endl;
+        std::vector<int> dims = {60, 45};
+        Environnement env_map = Environnement::createRandomEnvironment(dims, 0.20, 42, Environnement::MAP);
+        Environnement env_dense = Environnement::createRandomEnvironment(dims, 0.20, 42, Environnement::DENSE);
+
+        if (env_map.get_point_count() != env_dense.get_point_count()) {
+            throw std::runtime_error("Nombre de points différent entre MAP et DENSE");
+        }
+        for (int x = 0; x < dims[0]; x++) {
+            for (int y = 0; y < dims[1]; y++) {
+                std::vector<float> coords = {static_cast<float>(x), static_cast<float>(y)};
+                if (env_map.getPoint(coords).get_obs() != env_dense.getPoint(coords).get_obs()) {
+                    throw std::runtime_error("Obstacles différents entre MAP et DENSE");
+                }
+            }
+        }
+        if (env_dense.hasPoint({1.5f, 2.0f}) || env_dense.hasPoint({-1.0f, 0.0f})) {
+            throw std::runtime_error("DENSE ne doit contenir que des coordonnées entières dans la grille");
+        }
+        env_dense.toPNG(std::string(OUTPUT_DIR) + "environnement_dense.png");
+        std::cout << "Cartes identiques (" << env_dense.get_point_count() << " points)" << std::endl;
+
+        // Test 2: Dijkstra sur les deux backends
+        std::cout << "\n--- Test 2: Dijkstra MAP vs DENSE ---" << std::endl;
+        Dijkstra dijkstra_map(&env_map);
+        dijkstra_map.add_start({1.0f, 1.0f});
+        double t_map = timed_execute(dijkstra_map);
+
+        Dijkstra dijkstra_dense(&env_dense);
+        dijkstra_dense.add_start({1.0f, 1.0f});
+        double t_dense = timed_execute(dijkstra_dense);
+
+        int compared = compare_values(dijkstra_map, dijkstra_dense, dims);
+        std::cout << compared << " cellules identiques. MAP: " << t_map << " ms, DENSE: " << t_dense << " ms" << std::endl;
+
+        // Test 3: FMM avec départ flottant sur les deux backends
+        std::cout << "\n--- Test 3: FMM MAP vs DENSE ---" << std::endl;
+        FMM fmm_map(&env_map);
+        fmm_map.add_start({10.5f, 20.25f});
+        t_map = timed_execute(fmm_map);
+
+        FMM fmm_dense(&env_dense);
+        fmm_dense.add_start({10.5f, 20.25f});
+        t_dense = timed_execute(fmm_dense);
+
+        compared = compare_values(fmm_map, fmm_dense, dims);
+        std::cout << compared << " cellules identiques. MAP: " << t_map << " ms, DENSE: " << t_dense << " ms" << std::endl;
+
+        // Test 4: Environnement périodique sur les deux backends
+        std::cout << "\n--- Test 4: Périodique MAP vs DENSE ---" << std::endl;
+        auto periodic_map = PeriodicEnvironnement::createPeriodicMazeEnvironment(
+            {40, 30}, {true, false}, 7, Environnement::MAP);
+        auto periodic_dense = PeriodicEnvironnement::createPeriodicMazeEnvironment(
+            {40, 30}, {true, false}, 7, Environnement::DENSE);
+
+        Dijkstra periodic_search_map(periodic_map.get());
+        periodic_search_map.add_start({0.0f, 0.0f});
+        periodic_search_map.execute();
+
+        Dijkstra periodic_search_dense(periodic_dense.get());
+        periodic_search_dense.add_start({0.0f, 0.0f});
+        periodic_search_dense.execute();
+
+        compared = compare_values(periodic_search_map, periodic_search_dense, {40, 30});
+        std::cout << compared << " cellules identiques" << std::endl;
+
+        std::cout << "\n=== Tests Environnement terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test Environnement: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+#include "Environnement.hpp"
+#include "PeriodicEnvironnement.hpp"
+#include "algorithms/graph/FMM.hpp"
+#include "algorithms/graph/FastSweeping.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <chrono>
+#include <thread>
+#include <cmath>
+#include <algorithm>
+
+/**
+ * @brief Écarts tolérés vis-à-vis du FMM (même équation discrète, arrêt à la tolérance de convergence)
+ */
+constexpr float MAX_RELATIVE_ERROR = 1e-4f;
+constexpr double MEAN_RELATIVE_ERROR = 1e-5;
+
+/**
+ * @brief Compare deux champs : même accessibilité, écart relatif borné
+ * @return Écart relatif maximal
+ */
+static float compare_fields(const SearchWorkspace& actual, const SearchWorkspace& expected,
+                            float max_error, double mean_error, const std::string& label)
+{
+    float worst = 0.0f;
+    double sum = 0.0;
+    long long count = 0;
+    for (long long index = 0; index < expected.size(); index++) {
+        float a = actual.get_value(index), b = expected.get_value(index);
+        check(std::isinf(a) == std::isinf(b), label + " : accessibilité différente en " + std::to_string(index));
+        if (std::isinf(a)) continue;
+        float error = std::abs(a - b) / std::max(1.0f, b);
+        check(error <= max_error, label + " : " + std::to_string(a) + " au lieu de " + std::to_string(b) +
+                                      " en " + std::to_string(index));
+        worst = std::max(worst, error);
+        sum += error;
+        count++;
+    }
+    check(count == 0 || sum / count <= mean_error, label + " : écart moyen trop important");
+    return worst;
+}
+
+/**
+ * @brief FMM, balayage séquentiel et parallèle sur la même carte ; les deux balayages
+ * convergent vers le champ du FMM, à la tolérance de convergence près
+ */
+static void check_against_fmm(Environnement& env, const std::vector<float>& start, const std::string& label)
+{
+    FMM fmm(&env);
+    fmm.set_verbose(false);
+    fmm.add_start(start);
+    fmm.execute();
+
+    FastSweeping sequential(&env);
+    sequential.set_verbose(false);
+    sequential.add_start(start);
+    sequential.execute();
+    check(sequential.has_converged(), label + " : le balayage doit converger");
+
+    FastSweeping parallel(&env);
+    parallel.set_verbose(false);
+    parallel.set_parallel(true, 4);
+    parallel.add_start(start);
+    parallel.execute();
+    check(parallel.has_converged(), label + " : le balayage parallèle doit converger");
+
+    float error = compare_fields(sequential.get_workspace(), fmm.get_workspace(), MAX_RELATIVE_ERROR,
+                                 MEAN_RELATIVE_ERROR, label);
+    compare_fields(parallel.get_workspace(), sequential.get_workspace(), 1e-4f, 1e-5, label + " (parallèle)");
+    std::cout << label << " : écart max au FMM " << error << ", " << sequential.get_iterations()
+              << " tours (parallèle : " << parallel.get_iterations() << ")" << std::endl;
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests Fast Sweeping ===" << std::endl;
+
+        // Test 1: Carte vide, convergence en un tour (plus un tour de vérification)
+        std::cout << "\n--- Test 1: Carte vide ---" << std::endl;
+        Environnement empty(Environnement::DENSE);
+        empty.set_dims({120, 90});
+        check_against_fmm(empty, {60.0f, 45.0f}, "Vide");
+        FastSweeping single(&empty);
+        single.set_verbose(false);
+        single.add_start({60.0f, 45.0f});
+        single.execute();
+        check(single.get_iterations() == 2, "Une source sur carte vide doit converger en 2 tours");
+
+        // Test 2: Obstacles, backends DENSE et MAP, départ flottant, 3D, tore
+        std::cout << "\n--- Test 2: Cartes variées ---" << std::endl;
+        for (auto backend : {Environnement::DENSE, Environnement::MAP}) {
+            Environnement env = Environnement::createRandomEnvironment({80, 60}, 0.2, 9, backend);
+            check_against_fmm(env, {40.5f, 30.25f}, backend == Environnement::DENSE ? "DENSE" : "MAP");
+        }
+        Environnement volume = Environnement::createRandomEnvironment({30, 24, 20}, 0.1, 5, Environnement::DENSE);
+        volume.set_obs(volume.index_of({15.0f, 12.0f, 10.0f}), false);
+        check_against_fmm(volume, {15.0f, 12.0f, 10.0f}, "3D");
+        auto torus = PeriodicEnvironnement::createPeriodicRandomEnvironment({64, 48}, {true, false}, 0.1, 6, Environnement::DENSE);
+        torus->set_obs(torus->index_of({2.0f, 20.0f}), false);
+        check_against_fmm(*torus, {2.0f, 20.0f}, "Tore");
+
+        // Test 3: Volume vide : même équation discrète que le FMM, y compris en 3D
+        std::cout << "\n--- Test 3: Volume vide ---" << std::endl;
+        Environnement box(Environnement::DENSE);
+        box.set_dims({30, 24, 20});
+        check_against_fmm(box, {15.0f, 12.0f, 10.0f}, "Volume vide");
+
+        // Test 4: Boucle générique identique à la boucle spécialisée
+        std::cout << "\n--- Test 4: Boucle générique ---" << std::endl;
+        Environnement env = Environnement::createRandomEnvironment({70, 70}, 0.15, 4, Environnement::DENSE);
+        env.set_obs(env.index_of({35.0f, 35.0f}), false);
+        FastSweeping fixed_loop(&env), generic_loop(&env);
+        for (FastSweeping* solver : {&fixed_loop, &generic_loop}) {
+            solver->set_verbose(false);
+            solver->add_start({35.0f, 35.0f});
+        }
+        generic_loop.set_fixed_dimension_kernels(false);
+        fixed_loop.execute();
+        generic_loop.execute();
+        compare_fields(generic_loop.get_workspace(), fixed_loop.get_workspace(), 0.0f, 0.0, "Générique");
+        std::cout << "Champs identiques" << std::endl;
+
+        // Test 5: Limite de tours, paramètres refusés
+        std::cout << "\n--- Test 5: Limites ---" << std::endl;
+        Environnement maze = Environnement::createMazeEnvironment({41, 41}, 3, Environnement::DENSE);
+        maze.set_obs(maze.index_of({1.0f, 1.0f}), false);
+        FastSweeping limited(&maze);
+        limited.set_verbose(false);
+        limited.set_convergence(1e-5f, 1);
+        limited.add_start({1.0f, 1.0f});
+        limited.execute();
+        check(!limited.has_converged() && limited.get_iterations() == 1, "La limite de tours doit être respectée");
+        bool rejected = false;
+        try {
+            limited.set_convergence(-1.0f, 10);
+        } catch (const std::invalid_argument&) {
+            rejected = true;
+        }
+        check(rejected, "Une tolérance négative doit être refusée");
+        std::cout << "Labyrinthe limité à 1 tour : non convergé, tolérance négative refusée" << std::endl;
+
+        // Test 6: Temps sur une grande carte ouverte
+        std::cout << "\n--- Test 6: Carte ouverte ---" << std::endl;
+        Environnement open = Environnement::createRandomEnvironment({800, 800}, 0.01, 15, Environnement::DENSE);
+        open.set_obs(open.index_of({400.0f, 400.0f}), false);
+        FMM fmm(&open);
+        fmm.set_verbose(false);
+        fmm.add_start({400.0f, 400.0f});
+        auto t0 = std::chrono::high_resolution_clock::now();
+        fmm.execute();
+        auto t1 = std::chrono::high_resolution_clock::now();
+        std::cout << "FMM: " << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        for (bool parallel : {false, true}) {
+            FastSweeping sweeping(&open);
+            sweeping.set_verbose(false);
+            sweeping.set_parallel(parallel);
+            sweeping.add_start({400.0f, 400.0f});
+            t0 = std::chrono::high_resolution_clock::now();
+            sweeping.execute();
+            t1 = std::chrono::high_resolution_clock::now();
+            compare_fields(sweeping.get_workspace(), fmm.get_workspace(), MAX_RELATIVE_ERROR, MEAN_RELATIVE_ERROR, "Ouverte");
+            std::cout << (parallel ? "Balayage parallèle (" + std::to_string(std::thread::hardware_concurrency()) + " threads)"
+                                   : std::string("Balayage séquentiel"))
+                      << ": " << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, "
+                      << sweeping.get_iterations() << " tours" << std::endl;
+        }
+
+        std::cout << "\n=== Tests Fast Sweeping terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test Fast Sweeping: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+#include "Environnement.hpp"
+#include "PeriodicEnvironnement.hpp"
+#include "algorithms/graph/FMM.hpp"
+#include "algorithms/graph/FastSweeping.hpp"
+#include "algorithms/graph/FastIterativeMethod.hpp"
+#include "utils/PathExtractor.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <chrono>
+#include <thread>
+#include <cmath>
+#include <algorithm>
+
+/**
+ * @brief Compare deux champs : même accessibilité, écart relatif borné
+ * @return Écart relatif maximal
+ */
+static float compare_fields(const SearchWorkspace& actual, const SearchWorkspace& expected,
+                            float max_error, double mean_error, const std::string& label)
+{
+    float worst = 0.0f;
+    double sum = 0.0;
+    long long count = 0;
+    for (long long index = 0; index < expected.size(); index++) {
+        float a = actual.get_value(index), b = expected.get_value(index);
+        check(std::isinf(a) == std::isinf(b), label + " : accessibilité différente en " + std::to_string(index));
+        if (std::isinf(a)) continue;
+        float error = std::abs(a - b) / std::max(1.0f, b);
+        check(error <= max_error, label + " : " + std::to_string(a) + " au lieu de " + std::to_string(b) +
+                                      " en " + std::to_string(index));
+        worst = std::max(worst, error);
+        sum += error;
+        count++;
+    }
+    check(count == 0 || sum / count <= mean_error, label + " : écart moyen trop important");
+    return worst;
+}
+
+/**
+ * @brief FIM à 1 et 4 threads contre le balayage (même équation discrète, donc même point
+ * fixe) ; les deux exécutions FIM doivent être identiques
+ */
+static void check_against_sweeping(Environnement& env, const std::vector<float>& start, const std::string& label)
+{
+    FastSweeping sweeping(&env);
+    sweeping.set_verbose(false);
+    sweeping.add_start(start);
+    sweeping.execute();
+
+    FastIterativeMethod single(&env), multi(&env);
+    for (FastIterativeMethod* fim : {&single, &multi}) {
+        fim->set_verbose(false);
+        fim->add_start(start);
+    }
+    single.set_thread_count(1);
+    multi.set_thread_count(4);
+    single.execute();
+    multi.execute();
+
+    float error = compare_fields(single.get_workspace(), sweeping.get_workspace(), 1e-3f, 1e-4, label);
+    compare_fields(multi.get_workspace(), single.get_workspace(), 0.0f, 0.0, label + " (4 threads)");
+    check(single.get_iterations() > 0 && single.get_iterations() == multi.get_iterations(),
+          label + " : itérations incohérentes");
+    std::cout << label << " : écart max au balayage " << error << ", " << single.get_iterations()
+              << " itérations, liste active max " << single.get_peak_active() << std::endl;
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests Fast Iterative Method ===" << std::endl;
+
+        // Test 1: Même point fixe que le balayage, indépendant du nombre de threads
+        std::cout << "\n--- Test 1: Cartes variées ---" << std::endl;
+        Environnement empty(Environnement::DENSE);
+        empty.set_dims({120, 90});
+        check_against_sweeping(empty, {60.0f, 45.0f}, "Vide");
+        for (auto backend : {Environnement::DENSE, Environnement::MAP}) {
+            Environnement env = Environnement::createRandomEnvironment({80, 60}, 0.2, 9, backend);
+            check_against_sweeping(env, {40.5f, 30.25f}, backend == Environnement::DENSE ? "DENSE" : "MAP");
+        }
+        Environnement volume = Environnement::createRandomEnvironment({30, 24, 20}, 0.1, 5, Environnement::DENSE);
+        volume.set_obs(volume.index_of({15.0f, 12.0f, 10.0f}), false);
+        check_against_sweeping(volume, {15.0f, 12.0f, 10.0f}, "3D");
+        auto torus = PeriodicEnvironnement::createPeriodicRandomEnvironment({64, 48}, {true, false}, 0.1, 6, Environnement::DENSE);
+        torus->set_obs(torus->index_of({2.0f, 20.0f}), false);
+        check_against_sweeping(*torus, {2.0f, 20.0f}, "Tore");
+        Environnement maze = Environnement::createMazeEnvironment({41, 41}, 3, Environnement::DENSE);
+        maze.set_obs(maze.index_of({1.0f, 1.0f}), false);
+        check_against_sweeping(maze, {1.0f, 1.0f}, "Labyrinthe");
+
+        // Test 2: Même champ que le FMM, chemin extrait jusqu'au départ
+        std::cout << "\n--- Test 2: FMM et chemin ---" << std::endl;
+        Environnement env = Environnement::createRandomEnvironment({100, 100}, 0.2, 11, Environnement::DENSE);
+        env.set_obs(env.index_of({5.0f, 5.0f}), false);
+        env.set_obs(env.index_of({95.0f, 90.0f}), false);
+        FMM fmm(&env);
+        FastIterativeMethod fim(&env);
+        fmm.set_verbose(false);
+        fim.set_verbose(false);
+        fmm.add_start({5.0f, 5.0f});
+        fim.add_start({5.0f, 5.0f});
+        fmm.execute();
+        fim.execute();
+        float error = compare_fields(fim.get_workspace(), fmm.get_workspace(), 1e-4f, 1e-5, "FMM");
+        std::vector<long long> path = PathExtractor::extractPath(fim.get_workspace(), env.index_of({95.0f, 90.0f}));
+        check(!path.empty() && path.front() == env.index_of({5.0f, 5.0f}), "Le chemin doit remonter au départ");
+        std::cout << "Écart max au FMM " << error << ", chemin de " << path.size() << " cellules" << std::endl;
+
+        // Test 3: Paramètres refusés
+        std::cout << "\n--- Test 3: Paramètres refusés ---" << std::endl;
+        bool rejected = false;
+        try {
+            fim.set_tolerance(-1.0f);
+        } catch (const std::invalid_argument&) {
+            rejected = true;
+        }
+        check(rejected, "Une tolérance négative doit être refusée");
+        rejected = false;
+        try {
+            fim.set_thread_count(-2);
+        } catch (const std::invalid_argument&) {
+            rejected = true;
+        }
+        check(rejected, "Un nombre de threads négatif doit être refusé");
+        std::cout << "Tolérance et nombre de threads négatifs refusés" << std::endl;
+
+        // Test 4: Temps sur un volume 3D ouvert
+        std::cout << "\n--- Test 4: Volume ouvert ---" << std::endl;
+        Environnement open = Environnement::createRandomEnvironment({80, 80, 80}, 0.02, 15, Environnement::DENSE);
+        open.set_obs(open.index_of({40.0f, 40.0f, 40.0f}), false);
+        FMM reference(&open);
+        reference.set_verbose(false);
+        reference.add_start({40.0f, 40.0f, 40.0f});
+        auto t0 = std::chrono::high_resolution_clock::now();
+        reference.execute();
+        auto t1 = std::chrono::high_resolution_clock::now();
+        std::cout << "FMM: " << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        // Liste active assez grande pour être découpée : résultat identique quel que soit le découpage
+        FastIterativeMethod sequential(&open), threaded(&open);
+        for (FastIterativeMethod* timed : {&sequential, &threaded}) {
+            timed->set_verbose(false);
+            timed->set_thread_count(timed == &sequential ? 1 : 4);
+            timed->add_start({40.0f, 40.0f, 40.0f});
+            t0 = std::chrono::high_resolution_clock::now();
+            timed->execute();
+            t1 = std::chrono::high_resolution_clock::now();
+            std::cout << "FIM (" << timed->get_thread_count() << " threads): "
+                      << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, "
+                      << timed->get_iterations() << " itérations, liste active max " << timed->get_peak_active()
+                      << ", " << timed->get_statistics().expansions << " mises à jour" << std::endl;
+        }
+        check(sequential.get_peak_active() > 4 * 1024, "La liste active doit être découpée en lots");
+        compare_fields(threaded.get_workspace(), sequential.get_workspace(), 0.0f, 0.0, "Volume (4 threads)");
+        std::cout << "Champs identiques à 1 et 4 threads (" << std::thread::hardware_concurrency()
+                  << " coeurs disponibles)" << std::endl;
+
+        std::cout << "\n=== Tests Fast Iterative Method terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test FIM: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,214 @@
+#include "Environnement.hpp"
+#include "PeriodicEnvironnement.hpp"
+#include "algorithms/graph/FMM.hpp"
+#include "algorithms/graph/FastSweeping.hpp"
+#include "algorithms/graph/FastIterativeMethod.hpp"
+#include "algorithms/graph/IncrementalFMM.hpp"
+#include "utils/PathExtractor.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+
+/**
+ * @brief Erreurs relatives (moyenne, max) à la distance euclidienne exacte, hors du disque
+ * de rayon min_distance autour de la source (singularité du point source)
+ */
+static std::pair<double, double> error_to_exact(const Environnement& env, const FMM& fmm,
+                                                const std::vector<float>& start, float min_distance)
+{
+    double sum = 0.0, worst = 0.0;
+    long long count = 0;
+    for (long long index = 0; index < env.get_shape().get_total(); index++) {
+        float exact = env.calculate_distance(env.cell(index), start, 2);
+        if (exact < min_distance) continue;
+        double error = std::abs(fmm.get_workspace().get_value(index) - exact) / exact;
+        sum += error;
+        worst = std::max(worst, error);
+        count++;
+    }
+    return {sum / std::max(1LL, count), worst};
+}
+
+/**
+ * @brief FMM sur une grille vide, avec le schéma demandé
+ */
+static std::pair<double, double> run_empty(const std::vector<int>& dims, const std::vector<float>& start,
+                                           StencilOrder order, float min_distance)
+{
+    Environnement env(Environnement::DENSE);
+    env.set_dims(dims);
+    FMM fmm(&env);
+    fmm.set_verbose(false);
+    fmm.set_stencil_order(order);
+    fmm.add_start(start);
+    fmm.execute();
+    return error_to_exact(env, fmm, start, min_distance);
+}
+
+/**
+ * @brief Compare deux champs : même accessibilité, écart relatif borné
+ * @return Écart relatif maximal
+ */
+static float compare_fields(const SearchWorkspace& actual, const SearchWorkspace& expected,
+                            float max_error, const std::string& label)
+{
+    float worst = 0.0f;
+    for (long long index = 0; index < expected.size(); index++) {
+        float a = actual.get_value(index), b = expected.get_value(index);
+        check(std::isinf(a) == std::isinf(b), label + " : accessibilité différente en " + std::to_string(index));
+        if (std::isinf(a)) continue;
+        float error = std::abs(a - b) / std::max(1.0f, b);
+        check(error <= max_error, label + " : " + std::to_string(a) + " au lieu de " + std::to_string(b) +
+                                      " en " + std::to_string(index));
+        worst = std::max(worst, error);
+    }
+    return worst;
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests FMM ordre 2 ===" << std::endl;
+
+        // Test 1: Précision sur grille vide, à distance de la source (la singularité du point
+        // source limite l'ordre global, l'amélioration se mesure hors de son voisinage)
+        std::cout << "\n--- Test 1: Précision ---" << std::endl;
+        for (int size : {100, 200}) {
+            std::vector<float> start = {size / 2.0f, size / 2.0f};
+            auto first = run_empty({size, size}, start, FIRST_ORDER, size / 10.0f);
+            auto second = run_empty({size, size}, start, SECOND_ORDER, size / 10.0f);
+            std::cout << size << "x" << size << " : ordre 1 moyenne " << first.first << " max " << first.second
+                      << ", ordre 2 moyenne " << second.first << " max " << second.second << std::endl;
+            check(second.first * 3.0 < first.first && second.second < first.second,
+                  "L'ordre 2 doit diviser l'erreur moyenne par plus de 3 en 2D");
+        }
+        auto first_volume = run_empty({40, 40, 40}, {20.0f, 20.0f, 20.0f}, FIRST_ORDER, 4.0f);
+        auto second_volume = run_empty({40, 40, 40}, {20.0f, 20.0f, 20.0f}, SECOND_ORDER, 4.0f);
+        std::cout << "40^3 : ordre 1 moyenne " << first_volume.first << ", ordre 2 moyenne " << second_volume.first << std::endl;
+        check(second_volume.first * 2.0 < first_volume.first, "L'ordre 2 doit diviser l'erreur moyenne par plus de 2 en 3D");
+        auto coarse = run_empty({100, 100}, {50.0f, 50.0f}, SECOND_ORDER, 10.0f);
+        auto fine = run_empty({400, 400}, {200.0f, 200.0f}, FIRST_ORDER, 40.0f);
+        std::cout << "Ordre 2 en 100x100 : " << coarse.first << ", ordre 1 en 400x400 : " << fine.first << std::endl;
+        check(coarse.first < fine.first, "L'ordre 2 sur grille grossière doit battre l'ordre 1 sur grille 4x plus fine");
+
+        // Test 2: Boucle générique identique à la boucle spécialisée
+        std::cout << "\n--- Test 2: Boucle générique ---" << std::endl;
+        Environnement plane = Environnement::createRandomEnvironment({90, 70}, 0.2, 4, Environnement::DENSE);
+        plane.set_obs(plane.index_of({45.0f, 35.0f}), false);
+        Environnement volume = Environnement::createRandomEnvironment({30, 24, 20}, 0.1, 5, Environnement::MAP);
+        volume.set_obs(volume.index_of({15.0f, 12.0f, 10.0f}), false);
+        auto torus = PeriodicEnvironnement::createPeriodicRandomEnvironment({64, 48}, {true, false}, 0.1, 6, Environnement::DENSE);
+        torus->set_obs(torus->index_of({2.0f, 20.0f}), false);
+        std::vector<std::pair<Environnement*, std::vector<float>>> maps = {
+            {&plane, {45.0f, 35.0f}}, {&volume, {15.0f, 12.0f, 10.0f}}, {torus.get(), {2.0f, 20.0f}}};
+        for (auto& map : maps) {
+            FMM fixed_loop(map.first), generic_loop(map.first), first_order(map.first);
+            for (FMM* solver : {&fixed_loop, &generic_loop, &first_order}) {
+                solver->set_verbose(false);
+                solver->add_start(map.second);
+            }
+            fixed_loop.set_stencil_order(SECOND_ORDER);
+            generic_loop.set_stencil_order(SECOND_ORDER);
+            generic_loop.set_fixed_dimension_kernels(false);
+            fixed_loop.execute();
+            generic_loop.execute();
+            first_order.execute();
+            compare_fields(generic_loop.get_workspace(), fixed_loop.get_workspace(), 0.0f, "Générique");
+            // Obstacles : même accessibilité que l'ordre 1, valeurs proches
+            float gap = compare_fields(fixed_loop.get_workspace(), first_order.get_workspace(), 0.1f, "Ordre 1");
+            std::cout << map.first->get_shape().get_dim() << "D : champs identiques, écart max à l'ordre 1 " << gap << std::endl;
+        }
+
+        // Test 3: Champ de coût uniforme et chemin extrait
+        std::cout << "\n--- Test 3: Coût et chemin ---" << std::endl;
+        FMM unit(&plane);
+        unit.set_verbose(false);
+        unit.set_stencil_order(SECOND_ORDER);
+        unit.add_start({45.0f, 35.0f});
+        unit.execute();
+        SearchWorkspace unit_field = unit.get_workspace();
+        plane.set_cost_field(std::vector<float>(plane.get_shape().get_total(), 2.0f));
+        FMM doubled(&plane);
+        doubled.set_verbose(false);
+        doubled.set_stencil_order(SECOND_ORDER);
+        doubled.add_start({45.0f, 35.0f});
+        doubled.execute();
+        plane.clear_cost_field();
+        for (long long index = 0; index < plane.get_shape().get_total(); index++) {
+            float a = unit_field.get_value(index), b = doubled.get_workspace().get_value(index);
+            check(std::isinf(a) == std::isinf(b) && (std::isinf(a) || std::abs(2.0f * a - b) <= 1e-4f * std::max(1.0f, b)),
+                  "Un coût uniforme de 2 doit doubler le champ");
+        }
+        long long goal = -1;
+        for (long long index = 0; index < plane.get_shape().get_total(); index++) {
+            if (std::isfinite(unit_field.get_value(index)) &&
+                (goal < 0 || unit_field.get_value(index) > unit_field.get_value(goal))) goal = index;
+        }
+        std::vector<long long> path = PathExtractor::extractPath(unit.get_workspace(), goal);
+        check(!path.empty() && path.front() == plane.index_of({45.0f, 35.0f}), "Le chemin doit remonter au départ");
+        std::cout << "Champ doublé, chemin de " << path.size() << " cellules" << std::endl;
+
+        // Test 4: Solveurs restreints à l'ordre 1
+        std::cout << "\n--- Test 4: Ordre 1 uniquement ---" << std::endl;
+        FastSweeping sweeping(&plane);
+        FastIterativeMethod fim(&plane);
+        for (FMM* solver : {static_cast<FMM*>(&sweeping), static_cast<FMM*>(&fim)}) {
+            solver->set_verbose(false);
+            solver->set_stencil_order(SECOND_ORDER);
+            solver->add_start({45.0f, 35.0f});
+            bool rejected = false;
+            try {
+                solver->execute();
+            } catch (const std::logic_error&) {
+                rejected = true;
+            }
+            check(rejected, "Les solveurs itératifs doivent refuser l'ordre 2");
+        }
+        IncrementalFMM incremental(&plane);
+        incremental.set_verbose(false);
+        incremental.set_stencil_order(SECOND_ORDER);
+        incremental.add_start({45.0f, 35.0f});
+        incremental.execute();
+        long long blocked = plane.index_of({50.0f, 35.0f});
+        bool was_obstacle = plane.is_obstacle(blocked);
+        plane.set_obs(blocked, !was_obstacle);
+        incremental.update_cells({blocked});
+        incremental.execute();
+        check(!incremental.was_incremental(), "IncrementalFMM à l'ordre 2 doit recalculer entièrement");
+        FMM fresh(&plane);
+        fresh.set_verbose(false);
+        fresh.set_stencil_order(SECOND_ORDER);
+        fresh.add_start({45.0f, 35.0f});
+        fresh.execute();
+        compare_fields(incremental.get_workspace(), fresh.get_workspace(), 0.0f, "Incrémental");
+        plane.set_obs(blocked, was_obstacle);
+        std::cout << "Balayage et FIM refusés, IncrementalFMM recalculé entièrement" << std::endl;
+
+        // Test 5: Temps sur une grande carte ouverte
+        std::cout << "\n--- Test 5: Carte ouverte ---" << std::endl;
+        Environnement open = Environnement::createRandomEnvironment({800, 800}, 0.01, 15, Environnement::DENSE);
+        open.set_obs(open.index_of({400.0f, 400.0f}), false);
+        for (StencilOrder order : {FIRST_ORDER, SECOND_ORDER}) {
+            FMM timed(&open);
+            timed.set_verbose(false);
+            timed.set_stencil_order(order);
+            timed.add_start({400.0f, 400.0f});
+            auto t0 = std::chrono::high_resolution_clock::now();
+            timed.execute();
+            auto t1 = std::chrono::high_resolution_clock::now();
+            std::cout << (order == FIRST_ORDER ? "Ordre 1" : "Ordre 2") << ": "
+                      << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        }
+
+        std::cout << "\n=== Tests FMM ordre 2 terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test FMM ordre 2: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
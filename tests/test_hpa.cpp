@@ -0,0 +1,117 @@
+#include "Environnement.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/AStar.hpp"
+#include "algorithms/graph/HPAStar.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <random>
+#include <cmath>
+
+int main() {
+    try {
+        std::cout << "=== Tests HPA* ===" << std::endl;
+
+        // Test 1: Chemins valides, quasi optimaux, même accessibilité que Dijkstra
+        std::cout << "\n--- Test 1: Qualité des chemins ---" << std::endl;
+        for (auto backend : {Environnement::DENSE, Environnement::MAP}) {
+            Environnement env = Environnement::createRandomEnvironment({150, 120}, 0.25, 9, backend);
+            ClusterAbstraction abstraction(&env, 10);
+            abstraction.build();
+            HPAStar hpa(&abstraction);
+
+            std::mt19937 rng(4);
+            std::uniform_int_distribution<int> random_x(0, 149), random_y(0, 119);
+            float worst_ratio = 1.0f;
+            int found = 0;
+            for (int q = 0; q < 20; q++) {
+                std::vector<float> start = {static_cast<float>(random_x(rng)), static_cast<float>(random_y(rng))};
+                std::vector<float> goal = {static_cast<float>(random_x(rng)), static_cast<float>(random_y(rng))};
+                if (env.is_obstacle(env.index_of(start)) || env.is_obstacle(env.index_of(goal))) continue;
+
+                Dijkstra reference(&env);
+                reference.set_verbose(false);
+                reference.add_start(start);
+                reference.execute();
+                float optimal = reference.get_value(goal);
+
+                bool success = hpa.find_path(start, goal);
+                check(success == !std::isinf(optimal), "HPA* et Dijkstra ne s'accordent pas sur l'accessibilité");
+                if (!success) continue;
+                int steps = static_cast<int>(check_path(env, hpa.get_path(), env.index_of(start), env.index_of(goal), true));
+                check(steps == hpa.get_cost(), "La longueur du chemin raffiné doit égaler le coût abstrait");
+                check(hpa.get_cost() >= optimal, "HPA* ne peut pas battre Dijkstra");
+                if (optimal > 0.0f) worst_ratio = std::max(worst_ratio, hpa.get_cost() / optimal);
+                found++;
+            }
+            check(worst_ratio < 1.25f, "Chemin HPA* trop long");
+            std::cout << (backend == Environnement::DENSE ? "DENSE" : "MAP") << " : " << abstraction.get_node_count()
+                      << " nœuds abstraits, " << found << " chemins, pire rapport au coût optimal " << worst_ratio << std::endl;
+        }
+
+        // Test 2: Requête longue distance : HPA* vs A*
+        std::cout << "\n--- Test 2: Longue distance ---" << std::endl;
+        Environnement large = Environnement::createRandomEnvironment({600, 600}, 0.2, 13, Environnement::DENSE);
+        large.set_obs(large.index_of({2.0f, 2.0f}), false);
+        large.set_obs(large.index_of({597.0f, 590.0f}), false);
+        ClusterAbstraction large_abstraction(&large, 20);
+        large_abstraction.build();
+
+        HPAStar hpa(&large_abstraction);
+        check(hpa.find_path({2.0f, 2.0f}, {597.0f, 590.0f}), "Chemin attendu");
+
+        ManhattanHeuristic manhattan;
+        AStar astar(&large, 1.0f, &manhattan);
+        astar.set_verbose(false);
+        astar.add_start({2.0f, 2.0f});
+        astar.add_end({597.0f, 590.0f});
+        astar.execute();
+
+        long long hpa_expansions = hpa.get_statistics().abstract_expansions + hpa.get_statistics().local_expansions;
+        std::cout << "A*: coût " << astar.get_value({597.0f, 590.0f}) << ", " << astar.get_statistics().expansions
+                  << " expansions ; HPA*: coût " << hpa.get_cost() << ", " << hpa.get_statistics().abstract_expansions
+                  << " nœuds abstraits + " << hpa.get_statistics().local_expansions << " cellules (prétraitement: "
+                  << large_abstraction.get_preprocessing_expansions() << ")" << std::endl;
+        check(hpa_expansions < astar.get_statistics().expansions, "HPA* doit développer moins que A*");
+
+        // Test 3: Mise à jour locale après modification des obstacles
+        std::cout << "\n--- Test 3: Reconstruction d'un cluster ---" << std::endl;
+        Environnement room = Environnement::createRandomEnvironment({60, 60}, 0.0, 1, Environnement::DENSE);
+        ClusterAbstraction room_abstraction(&room, 10);
+        room_abstraction.build();
+        HPAStar room_hpa(&room_abstraction);
+        check(room_hpa.find_path({25.0f, 5.0f}, {25.0f, 55.0f}), "Chemin attendu");
+        float open_cost = room_hpa.get_cost();
+        check(open_cost >= 50.0f && open_cost < 50.0f * 1.25f, "Chemin quasi rectiligne attendu");
+
+        // Mur horizontal avec une seule ouverture, dans les clusters de la rangée y = 30..39
+        std::vector<long long> changed;
+        for (int x = 0; x < 60; x++) {
+            if (x == 57) continue;
+            long long index = room.index_of({static_cast<float>(x), 33.0f});
+            room.set_obs(index, true);
+            changed.push_back(index);
+        }
+        room_abstraction.update_cells(changed);
+        check(room_hpa.find_path({25.0f, 5.0f}, {25.0f, 55.0f}), "Chemin par l'ouverture attendu");
+        check_path(room, room_hpa.get_path(), room.index_of({25.0f, 5.0f}), room.index_of({25.0f, 55.0f}), true);
+
+        Dijkstra room_reference(&room);
+        room_reference.set_verbose(false);
+        room_reference.add_start({25.0f, 5.0f});
+        room_reference.execute();
+        check(room_hpa.get_cost() >= room_reference.get_value({25.0f, 55.0f}), "Coût inférieur à l'optimum");
+        check(room_hpa.get_cost() > open_cost, "Le mur doit allonger le chemin");
+        std::cout << "Avant le mur: " << open_cost << ", après le mur: coût HPA* " << room_hpa.get_cost() << " (Dijkstra: "
+                  << room_reference.get_value({25.0f, 55.0f}) << ")" << std::endl;
+
+        std::cout << "\n=== Tests HPA* terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test HPA*: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+#include "Environnement.hpp"
+#include "PeriodicEnvironnement.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/IncrementalDijkstra.hpp"
+#include "algorithms/graph/neighbors/GridNeighbors.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <chrono>
+#include <random>
+#include <cmath>
+
+/**
+ * @brief Compare le champ incrémental à un Dijkstra complet, cellule par cellule
+ */
+static void compare_with_dijkstra(Environnement& env, const IncrementalDijkstra& incremental,
+                                  NeighborhoodStrategy* neighborhood, const std::vector<std::vector<float>>& starts,
+                                  float cost)
+{
+    Dijkstra reference(&env, cost);
+    reference.set_verbose(false);
+    reference.set_neighborhood(neighborhood);
+    for (const auto& start : starts) reference.add_start(start);
+    reference.execute();
+
+    const SearchWorkspace& expected = reference.get_workspace();
+    const SearchWorkspace& actual = incremental.get_workspace();
+    for (long long index = 0; index < expected.size(); index++) {
+        float a = actual.get_value(index), b = expected.get_value(index);
+        if (std::isinf(a) != std::isinf(b) || (!std::isinf(a) && std::abs(a - b) > 1e-4f)) {
+            throw std::runtime_error("Champ différent en " + std::to_string(index) + ": " +
+                                     std::to_string(a) + " au lieu de " + std::to_string(b));
+        }
+    }
+}
+
+/**
+ * @brief Lots de changements aléatoires (cellules isolées et blocs), chaque réparation comparée à Dijkstra
+ * @return Expansions moyennes par réparation
+ */
+static double run_rounds(Environnement& env, NeighborhoodStrategy* neighborhood,
+                         const std::vector<std::vector<float>>& starts, int rounds, unsigned seed)
+{
+    const GridShape& shape = env.get_shape();
+    IncrementalDijkstra incremental(&env);
+    incremental.set_verbose(false);
+    incremental.set_neighborhood(neighborhood);
+    for (const auto& start : starts) incremental.add_start(start);
+    incremental.execute();
+    compare_with_dijkstra(env, incremental, neighborhood, starts, 1.0f);
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<long long> random_cell(0, shape.get_total() - 1);
+    std::uniform_int_distribution<int> batch_size(1, 12);
+    long long expansions = 0;
+    for (int round = 0; round < rounds; round++) {
+        std::vector<long long> changed;
+        int count = batch_size(rng);
+        for (int k = 0; k < count; k++) {
+            long long cell = random_cell(rng);
+            if (!env.has_index(cell)) continue;
+            env.set_obs(cell, !env.is_obstacle(cell));
+            changed.push_back(cell);
+        }
+        incremental.update_cells(changed);
+        incremental.execute();
+        check(incremental.was_incremental(), "La mise à jour devait être incrémentale");
+        compare_with_dijkstra(env, incremental, neighborhood, starts, 1.0f);
+        expansions += incremental.get_statistics().expansions;
+    }
+    return static_cast<double>(expansions) / rounds;
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests Dijkstra incrémental ===" << std::endl;
+
+        // Test 1: Changements aléatoires, backends DENSE et MAP, départ flottant
+        std::cout << "\n--- Test 1: Réparations vs Dijkstra complet ---" << std::endl;
+        for (auto backend : {Environnement::DENSE, Environnement::MAP}) {
+            Environnement env = Environnement::createRandomEnvironment({80, 60}, 0.25, 31, backend);
+            double expansions = run_rounds(env, nullptr, {{40.5f, 30.25f}, {3.0f, 4.0f}}, 40, 6);
+            std::cout << (backend == Environnement::DENSE ? "DENSE" : "MAP") << " : champs identiques, "
+                      << expansions << " expansions par réparation (" << 80 * 60 << " cellules)" << std::endl;
+        }
+
+        // Test 2: 8-connexe et carte périodique
+        std::cout << "\n--- Test 2: 8-connexe et périodique ---" << std::endl;
+        Environnement open = Environnement::createRandomEnvironment({60, 60}, 0.15, 4, Environnement::DENSE);
+        GridNeighbors full(GridNeighbors::FULL);
+        run_rounds(open, &full, {{30.0f, 30.0f}}, 30, 9);
+        auto torus = PeriodicEnvironnement::createPeriodicMazeEnvironment({41, 31}, {true, true}, 3, Environnement::DENSE);
+        run_rounds(*torus, nullptr, {{1.0f, 1.0f}}, 30, 10);
+        std::cout << "Champs identiques" << std::endl;
+
+        // Test 3: Déplacement du départ, changement du coût d'arête
+        std::cout << "\n--- Test 3: Départs et coût ---" << std::endl;
+        Environnement depot = Environnement::createMazeEnvironment({61, 61}, 8, Environnement::DENSE);
+        depot.set_obs(depot.index_of({1.0f, 1.0f}), false);
+        depot.set_obs(depot.index_of({59.0f, 59.0f}), false);
+        IncrementalDijkstra incremental(&depot);
+        incremental.set_verbose(false);
+        incremental.add_start({1.0f, 1.0f});
+        incremental.execute();
+        incremental.add_start({59.0f, 59.0f});
+        incremental.execute();
+        check(incremental.was_incremental(), "L'ajout d'un départ doit être incrémental");
+        compare_with_dijkstra(depot, incremental, nullptr, {{1.0f, 1.0f}, {59.0f, 59.0f}}, 1.0f);
+        incremental.clear_starts();
+        incremental.add_start({59.0f, 59.0f});
+        incremental.execute();
+        compare_with_dijkstra(depot, incremental, nullptr, {{59.0f, 59.0f}}, 1.0f);
+        incremental.set_edge_cost(2.5f);
+        incremental.execute();
+        check(!incremental.was_incremental(), "Un changement de coût d'arête impose un calcul complet");
+        compare_with_dijkstra(depot, incremental, nullptr, {{59.0f, 59.0f}}, 2.5f);
+        std::cout << "Départs ajoutés / retirés et nouveau coût : champs identiques" << std::endl;
+
+        // Test 4: Coût d'un changement local sur une grande carte
+        std::cout << "\n--- Test 4: Changement local ---" << std::endl;
+        Environnement large = Environnement::createRandomEnvironment({500, 500}, 0.2, 23, Environnement::DENSE);
+        large.set_obs(large.index_of({250.0f, 250.0f}), false);
+        IncrementalDijkstra field(&large);
+        field.set_verbose(false);
+        field.add_start({250.0f, 250.0f});
+        auto t0 = std::chrono::high_resolution_clock::now();
+        field.execute();
+        auto t1 = std::chrono::high_resolution_clock::now();
+        long long full_expansions = field.get_statistics().expansions;
+
+        std::vector<long long> changed;
+        for (int y = 400; y < 410; y++) {
+            long long cell = large.index_of({420.0f, static_cast<float>(y)});
+            large.set_obs(cell, !large.is_obstacle(cell));
+            changed.push_back(cell);
+        }
+        field.update_cells(changed);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        field.execute();
+        auto t3 = std::chrono::high_resolution_clock::now();
+        compare_with_dijkstra(large, field, nullptr, {{250.0f, 250.0f}}, 1.0f);
+        check(field.get_statistics().expansions * 20 < full_expansions, "La réparation doit rester locale");
+        std::cout << "Calcul complet: " << full_expansions << " expansions, "
+                  << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        std::cout << "Réparation: " << field.get_statistics().expansions << " expansions, "
+                  << std::chrono::duration<double, std::milli>(t3 - t2).count() << " ms" << std::endl;
+
+        std::cout << "\n=== Tests Dijkstra incrémental terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test Dijkstra incrémental: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+#include "Environnement.hpp"
+#include "PeriodicEnvironnement.hpp"
+#include "algorithms/graph/FMM.hpp"
+#include "algorithms/graph/IncrementalFMM.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <algorithm>
+
+/**
+ * @brief Écarts tolérés vis-à-vis d'un FMM complet (arrondis, et seuil de baisse nette de la réparation)
+ */
+constexpr float MAX_RELATIVE_ERROR = 1e-4f;
+constexpr double MEAN_RELATIVE_ERROR = 1e-5;
+
+/**
+ * @brief Compare le champ incrémental à un FMM complet : même accessibilité, valeurs proches
+ * @return Écart relatif maximal
+ */
+static float compare_with_fmm(Environnement& env, const IncrementalFMM& incremental,
+                              const std::vector<std::vector<float>>& starts, float cost)
+{
+    FMM reference(&env, cost);
+    reference.set_verbose(false);
+    for (const auto& start : starts) reference.add_start(start);
+    reference.execute();
+
+    const SearchWorkspace& expected = reference.get_workspace();
+    const SearchWorkspace& actual = incremental.get_workspace();
+    float max_error = 0.0f;
+    double sum = 0.0;
+    long long count = 0;
+    for (long long index = 0; index < expected.size(); index++) {
+        float a = actual.get_value(index), b = expected.get_value(index);
+        check(std::isinf(a) == std::isinf(b), "Accessibilité différente en " + std::to_string(index));
+        if (std::isinf(a)) continue;
+        float error = std::abs(a - b) / std::max(cost, b);
+        check(error <= MAX_RELATIVE_ERROR, "Champ différent en " + std::to_string(index) + ": " +
+                                               std::to_string(a) + " au lieu de " + std::to_string(b));
+        max_error = std::max(max_error, error);
+        sum += error;
+        count++;
+    }
+    check(count == 0 || sum / count <= MEAN_RELATIVE_ERROR, "Écart moyen trop important");
+    return max_error;
+}
+
+/**
+ * @brief Lots d'obstacles basculés au hasard, chaque réparation comparée à un FMM complet
+ * @return Expansions moyennes par réparation
+ */
+static double run_rounds(Environnement& env, const std::vector<std::vector<float>>& starts, int rounds,
+                         unsigned seed, float& max_error)
+{
+    const GridShape& shape = env.get_shape();
+    IncrementalFMM incremental(&env);
+    incremental.set_verbose(false);
+    for (const auto& start : starts) incremental.add_start(start);
+    incremental.execute();
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<long long> random_cell(0, shape.get_total() - 1);
+    std::uniform_int_distribution<int> batch_size(1, 8);
+    long long expansions = 0;
+    max_error = 0.0f;
+    for (int round = 0; round < rounds; round++) {
+        std::vector<long long> changed;
+        int count = batch_size(rng);
+        for (int k = 0; k < count; k++) {
+            long long cell = random_cell(rng);
+            if (!env.has_index(cell)) continue;
+            env.set_obs(cell, !env.is_obstacle(cell));
+            changed.push_back(cell);
+        }
+        incremental.update_cells(changed);
+        incremental.execute();
+        check(incremental.was_incremental(), "La mise à jour devait être incrémentale");
+        max_error = std::max(max_error, compare_with_fmm(env, incremental, starts, 1.0f));
+        expansions += incremental.get_statistics().expansions;
+    }
+    return static_cast<double>(expansions) / rounds;
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests FMM incrémental ===" << std::endl;
+
+        // Test 1: Obstacles basculés au hasard, backends DENSE et MAP, départs flottants
+        std::cout << "\n--- Test 1: Réparations vs FMM complet ---" << std::endl;
+        for (auto backend : {Environnement::DENSE, Environnement::MAP}) {
+            Environnement env = Environnement::createRandomEnvironment({90, 70}, 0.2, 41, backend);
+            float max_error = 0.0f;
+            double expansions = run_rounds(env, {{45.5f, 35.25f}, {5.0f, 6.0f}}, 30, 12, max_error);
+            std::cout << (backend == Environnement::DENSE ? "DENSE" : "MAP") << " : écart max " << max_error
+                      << ", " << expansions << " expansions par réparation (" << 90 * 70 << " cellules)" << std::endl;
+        }
+
+        // Test 2: 3D et carte périodique
+        std::cout << "\n--- Test 2: 3D et périodique ---" << std::endl;
+        float max_error = 0.0f;
+        Environnement volume = Environnement::createRandomEnvironment({24, 20, 16}, 0.15, 7, Environnement::DENSE);
+        run_rounds(volume, {{12.0f, 10.0f, 8.0f}}, 20, 3, max_error);
+        std::cout << "3D : écart max " << max_error << std::endl;
+        auto torus = PeriodicEnvironnement::createPeriodicMazeEnvironment({41, 31}, {true, true}, 5, Environnement::DENSE);
+        run_rounds(*torus, {{1.0f, 1.0f}}, 20, 4, max_error);
+        std::cout << "Tore : écart max " << max_error << std::endl;
+
+        // Test 3: Déplacement du départ, changement de coût
+        std::cout << "\n--- Test 3: Départs et coût ---" << std::endl;
+        Environnement depot = Environnement::createRandomEnvironment({61, 61}, 0.15, 8, Environnement::DENSE);
+        depot.set_obs(depot.index_of({1.0f, 1.0f}), false);
+        depot.set_obs(depot.index_of({59.0f, 59.0f}), false);
+        IncrementalFMM incremental(&depot);
+        incremental.set_verbose(false);
+        incremental.add_start({1.0f, 1.0f});
+        incremental.execute();
+        incremental.add_start({59.0f, 59.0f});
+        incremental.execute();
+        check(incremental.was_incremental(), "L'ajout d'un départ doit être incrémental");
+        compare_with_fmm(depot, incremental, {{1.0f, 1.0f}, {59.0f, 59.0f}}, 1.0f);
+        incremental.clear_starts();
+        incremental.add_start({59.0f, 59.0f});
+        incremental.execute();
+        compare_with_fmm(depot, incremental, {{59.0f, 59.0f}}, 1.0f);
+        incremental.set_cost_per_unit_distance(2.5f);
+        incremental.execute();
+        check(!incremental.was_incremental(), "Un changement de coût impose un calcul complet");
+        compare_with_fmm(depot, incremental, {{59.0f, 59.0f}}, 2.5f);
+        std::cout << "Départs ajoutés / retirés et nouveau coût : champs cohérents" << std::endl;
+
+        // Test 4: Coût d'un changement local sur une grande carte
+        std::cout << "\n--- Test 4: Changement local ---" << std::endl;
+        Environnement large = Environnement::createRandomEnvironment({500, 500}, 0.2, 23, Environnement::DENSE);
+        large.set_obs(large.index_of({250.0f, 250.0f}), false);
+        IncrementalFMM field(&large);
+        field.set_verbose(false);
+        field.add_start({250.0f, 250.0f});
+        auto t0 = std::chrono::high_resolution_clock::now();
+        field.execute();
+        auto t1 = std::chrono::high_resolution_clock::now();
+        long long full_expansions = field.get_statistics().expansions;
+
+        std::vector<long long> changed;
+        for (int y = 400; y < 410; y++) {
+            long long cell = large.index_of({420.0f, static_cast<float>(y)});
+            large.set_obs(cell, !large.is_obstacle(cell));
+            changed.push_back(cell);
+        }
+        field.update_cells(changed);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        field.execute();
+        auto t3 = std::chrono::high_resolution_clock::now();
+        compare_with_fmm(large, field, {{250.0f, 250.0f}}, 1.0f);
+        check(field.get_statistics().expansions * 20 < full_expansions, "La réparation doit rester locale");
+        std::cout << "Calcul complet: " << full_expansions << " expansions, "
+                  << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        std::cout << "Réparation: " << field.get_statistics().expansions << " expansions ("
+                  << field.get_repaired_count() << " cellules), "
+                  << std::chrono::duration<double, std::milli>(t3 - t2).count() << " ms" << std::endl;
+
+        std::cout << "\n=== Tests FMM incrémental terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test FMM incrémental: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+#include "Environnement.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/AStar.hpp"
+#include "algorithms/graph/JPS.hpp"
+#include "algorithms/graph/neighbors/GridNeighbors.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <random>
+#include <cmath>
+
+int main() {
+    try {
+        std::cout << "=== Tests Jump Point Search ===" << std::endl;
+        GridNeighbors full(GridNeighbors::FULL);
+
+        // Test 1: JPS et JPS+ donnent les distances de Dijkstra 8-connexe
+        std::cout << "\n--- Test 1: Optimalité sur cartes aléatoires ---" << std::endl;
+        std::mt19937 rng(3);
+        int queries = 0;
+        for (auto backend : {Environnement::DENSE, Environnement::MAP}) {
+            for (double density : {0.1, 0.3}) {
+                Environnement env = Environnement::createRandomEnvironment({120, 90}, density, 11, backend);
+                std::uniform_int_distribution<int> random_x(0, 119), random_y(0, 89);
+                std::shared_ptr<const JumpPointTable> shared_table;
+
+                for (int q = 0; q < 6; q++) {
+                    std::vector<float> start = {static_cast<float>(random_x(rng)), static_cast<float>(random_y(rng))};
+                    std::vector<float> goal = {static_cast<float>(random_x(rng)), static_cast<float>(random_y(rng))};
+                    env.set_obs(env.index_of(start), false);
+                    env.set_obs(env.index_of(goal), false);
+
+                    float optimal = reference_cost(env, &full, start, goal);
+
+                    JPS jps(&env);
+                    jps.add_start(start);
+                    jps.add_end(goal);
+                    jps.execute();
+
+                    // Les obstacles changent d'une requête à l'autre : table recalculée
+                    JPSPlus jps_plus(&env);
+                    jps_plus.add_start(start);
+                    jps_plus.add_end(goal);
+                    jps_plus.execute();
+                    shared_table = jps_plus.get_jump_table();
+
+                    for (const JPS* search : {static_cast<const JPS*>(&jps), static_cast<const JPS*>(&jps_plus)}) {
+                        float value = search->get_value(goal);
+                        check(std::isinf(value) == std::isinf(optimal), "Accessibilité différente de Dijkstra");
+                        if (std::isinf(optimal)) continue;
+                        check(std::abs(value - optimal) < 1e-3f, "Coût JPS différent de Dijkstra: " +
+                              std::to_string(value) + " vs " + std::to_string(optimal));
+                        float length = check_path(env, search->extract_path(goal), env.index_of(start), env.index_of(goal));
+                        check(std::abs(length - optimal) < 1e-3f, "Longueur du chemin JPS incorrecte");
+                    }
+                    queries++;
+                }
+
+                // Table partagée entre recherches sur le même environnement
+                JPSPlus reuse(&env);
+                reuse.set_jump_table(shared_table);
+                reuse.add_start({0.0f, 0.0f});
+                reuse.add_end({119.0f, 89.0f});
+                env.set_obs(env.index_of({0.0f, 0.0f}), false);
+                env.set_obs(env.index_of({119.0f, 89.0f}), false);
+                reuse.rebuild_jump_table();
+                reuse.execute();
+                check(reuse.get_jump_table() != shared_table, "rebuild_jump_table doit remplacer la table");
+
+                // Obstacles modifiés sans reconstruction explicite : table périmée détectée
+                std::shared_ptr<const JumpPointTable> stale = reuse.get_jump_table();
+                long long toggled = env.index_of({60.0f, 45.0f});
+                env.set_obs(toggled, !env.is_obstacle(toggled));
+                reuse.execute();
+                check(reuse.get_jump_table() != stale, "Une table périmée doit être recalculée");
+                Dijkstra reference(&env, 1.0f);
+                reference.set_verbose(false);
+                reference.set_neighborhood(&full);
+                reference.add_start({0.0f, 0.0f});
+                reference.execute();
+                float expected = reference.get_value({119.0f, 89.0f});
+                float actual = reuse.get_value({119.0f, 89.0f});
+                check(std::isinf(expected) == std::isinf(actual) &&
+                      (std::isinf(expected) || std::abs(expected - actual) < 1e-3f), "JPS+ après modification différent de Dijkstra");
+                bool rejected = false;
+                try {
+                    reuse.set_jump_table(stale);
+                } catch (const std::invalid_argument&) {
+                    rejected = true;
+                }
+                check(rejected, "Une table d'une autre disposition d'obstacles doit être refusée");
+
+                // Une copie partage la version des obstacles jusqu'à sa première modification
+                Environnement copy(env);
+                JPSPlus on_copy(&copy);
+                on_copy.set_jump_table(reuse.get_jump_table());
+                copy.set_obs(toggled, !copy.is_obstacle(toggled));
+                rejected = false;
+                try {
+                    on_copy.set_jump_table(reuse.get_jump_table());
+                } catch (const std::invalid_argument&) {
+                    rejected = true;
+                }
+                check(rejected, "Une copie modifiée ne doit plus accepter la table");
+            }
+        }
+        std::cout << queries << " requêtes identiques à Dijkstra" << std::endl;
+
+        // Test 2: Expansions JPS vs A* octile sur une carte ouverte
+        std::cout << "\n--- Test 2: Expansions ---" << std::endl;
+        // Carte ouverte : grands espaces libres et quelques blocs rectangulaires
+        Environnement open = Environnement::createRandomEnvironment({400, 400}, 0.0, 5, Environnement::DENSE);
+        const int blocks[][4] = {{60, 40, 120, 200}, {150, 220, 300, 260}, {250, 20, 280, 180}, {320, 280, 360, 390}};
+        for (const auto& block : blocks) {
+            for (int x = block[0]; x < block[2]; x++) {
+                for (int y = block[1]; y < block[3]; y++) {
+                    open.set_obs(open.index_of({static_cast<float>(x), static_cast<float>(y)}), true);
+                }
+            }
+        }
+
+        OctileHeuristic octile;
+        AStar astar(&open, 1.0f, &octile);
+        astar.set_neighborhood(&full);
+        astar.add_start({5.0f, 5.0f});
+        astar.add_end({390.0f, 300.0f});
+        astar.execute();
+
+        JPS jps(&open);
+        jps.add_start({5.0f, 5.0f});
+        jps.add_end({390.0f, 300.0f});
+        jps.execute();
+
+        JPSPlus jps_plus(&open);
+        jps_plus.add_start({5.0f, 5.0f});
+        jps_plus.add_end({390.0f, 300.0f});
+        jps_plus.execute();
+
+        float cost = astar.get_value({390.0f, 300.0f});
+        check(std::abs(jps.get_value({390.0f, 300.0f}) - cost) < 1e-3f, "JPS doit trouver le coût d'A*");
+        check(std::abs(jps_plus.get_value({390.0f, 300.0f}) - cost) < 1e-3f, "JPS+ doit trouver le coût d'A*");
+        check(jps.get_statistics().expansions * 10 < astar.get_statistics().expansions &&
+              jps_plus.get_statistics().expansions * 10 < astar.get_statistics().expansions,
+              "JPS doit développer au moins 10 fois moins de cellules qu'A*");
+        std::cout << "Coût " << cost << " - A* octile: " << astar.get_statistics().expansions << " expansions, JPS: "
+                  << jps.get_statistics().expansions << ", JPS+: " << jps_plus.get_statistics().expansions << std::endl;
+
+        // Test 3: Environnement non supporté
+        std::cout << "\n--- Test 3: Environnement 3D refusé ---" << std::endl;
+        Environnement env3d = Environnement::createRandomEnvironment({8, 8, 8}, 0.0, 1, Environnement::DENSE);
+        JPS jps3d(&env3d);
+        jps3d.add_start({0.0f, 0.0f, 0.0f});
+        bool rejected = false;
+        try {
+            jps3d.execute();
+        } catch (const std::invalid_argument&) {
+            rejected = true;
+        }
+        check(rejected, "JPS doit refuser un environnement 3D");
+        std::cout << "Exception levée" << std::endl;
+
+        std::cout << "\n=== Tests Jump Point Search terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test Jump Point Search: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,205 @@
+#include "Environnement.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/AStar.hpp"
+#include "algorithms/strategies/LandmarkHeuristic.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifndef OUTPUT_DIR
+#define OUTPUT_DIR ""
+#endif
+
+int main() {
+    try {
+        std::cout << "=== Tests Heuristique ALT (repères) ===" << std::endl;
+
+        Environnement maze = Environnement::createMazeEnvironment({121, 121}, 5, Environnement::DENSE);
+        maze.set_obs(maze.index_of({0.0f, 0.0f}), false);
+        const GridShape& shape = maze.get_shape();
+
+        // Arrivée : la cellule atteignable la plus proche du coin opposé
+        Dijkstra from_start(&maze);
+        from_start.add_start({0.0f, 0.0f});
+        from_start.execute();
+        std::vector<float> goal;
+        for (int d = 0; goal.empty(); d++) {
+            for (int x = 120; x >= 120 - d && goal.empty(); x--) {
+                std::vector<float> candidate = {static_cast<float>(x), static_cast<float>(120 - d + (120 - x))};
+                if (candidate[1] <= 120 && !std::isinf(from_start.get_value(candidate))) goal = candidate;
+            }
+        }
+
+        // Distances exactes vers l'arrivée (graphe non orienté)
+        Dijkstra from_goal(&maze);
+        from_goal.add_start(goal);
+        from_goal.execute();
+
+        // Test 1: Admissibilité et optimalité des deux sélections
+        std::cout << "\n--- Test 1: Admissibilité, A* avec ALT ---" << std::endl;
+        float optimal = from_start.get_value(goal);
+        LandmarkHeuristic farthest(8, LandmarkHeuristic::FARTHEST, 1);
+        LandmarkHeuristic avoid(8, LandmarkHeuristic::AVOID, 1);
+        farthest.preprocess(&maze);
+        avoid.preprocess(&maze);
+
+        for (LandmarkHeuristic* alt : {&farthest, &avoid}) {
+            check(static_cast<int>(alt->get_landmarks().size()) == 8, "8 repères attendus");
+            for (long long index = 0; index < shape.get_total(); index++) {
+                float exact = from_goal.get_workspace().get_value(index);
+                if (std::isinf(exact)) continue;
+                check(alt->estimate(index, goal) <= exact + 1e-4f, alt->get_name() + " surestime la distance");
+            }
+
+            AStar astar_alt(&maze, 1.0f, alt);
+            astar_alt.add_start({0.0f, 0.0f});
+            astar_alt.add_end(goal);
+            astar_alt.execute();
+            check(astar_alt.get_value(goal) == optimal, alt->get_name() + " : A* non optimal");
+            std::cout << alt->get_name() << " : coût " << optimal << ", "
+                      << astar_alt.get_statistics().expansions << " expansions" << std::endl;
+        }
+
+        // Test 2: Entrepôt en serpentin : Manhattan ignore les murs, ALT non
+        std::cout << "\n--- Test 2: Entrepôt en serpentin ---" << std::endl;
+        Environnement warehouse = Environnement::createRandomEnvironment({120, 120}, 0.0, 1, Environnement::DENSE);
+        for (int x = 10; x < 120; x += 10) {
+            for (int y = 0; y < 120; y++) {
+                bool gap = ((x / 10) % 2 == 1) ? y >= 115 : y < 5;
+                if (!gap) warehouse.set_obs(warehouse.index_of({static_cast<float>(x), static_cast<float>(y)}), true);
+            }
+        }
+        ManhattanHeuristic manhattan;
+        AStar astar_manhattan(&warehouse, 1.0f, &manhattan);
+        astar_manhattan.add_start({3.0f, 60.0f});
+        astar_manhattan.add_end({115.0f, 60.0f});
+        astar_manhattan.execute();
+
+        for (auto method : {LandmarkHeuristic::FARTHEST, LandmarkHeuristic::AVOID}) {
+            LandmarkHeuristic alt(8, method, 1);
+            alt.preprocess(&warehouse);
+            AStar astar_alt(&warehouse, 1.0f, &alt);
+            astar_alt.add_start({3.0f, 60.0f});
+            astar_alt.add_end({115.0f, 60.0f});
+            astar_alt.execute();
+            check(astar_alt.get_value({115.0f, 60.0f}) == astar_manhattan.get_value({115.0f, 60.0f}),
+                  alt.get_name() + " : A* non optimal");
+            check(astar_alt.get_statistics().expansions < astar_manhattan.get_statistics().expansions,
+                  alt.get_name() + " doit développer moins de cellules que Manhattan");
+            std::cout << alt.get_name() << " : " << astar_alt.get_statistics().expansions
+                      << " expansions (Manhattan: " << astar_manhattan.get_statistics().expansions << ")" << std::endl;
+        }
+
+        // Test 3: Sauvegarde / rechargement
+        std::cout << "\n--- Test 3: Sauvegarde des tables ---" << std::endl;
+        std::string filename = std::string(OUTPUT_DIR) + "landmarks_maze.alt";
+        avoid.save(filename);
+        LandmarkHeuristic loaded;
+        loaded.load(filename, &maze);
+        check(loaded.get_landmarks() == avoid.get_landmarks(), "Repères rechargés différents");
+        for (long long index = 0; index < shape.get_total(); index += 7) {
+            check(loaded.estimate(index, goal) == avoid.estimate(index, goal), "Tables rechargées différentes");
+        }
+
+        Environnement other = Environnement::createMazeEnvironment({121, 121}, 6, Environnement::DENSE);
+        bool rejected = false;
+        try {
+            loaded.load(filename, &other);
+        } catch (const std::runtime_error&) {
+            rejected = true;
+        }
+        check(rejected, "Un fichier d'une autre carte doit être refusé");
+
+        // Fichiers corrompus : nombre de repères puis repère hors de la grille
+        std::string original;
+        {
+            std::ifstream input(filename, std::ios::binary);
+            original.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+        }
+        size_t landmark_count = avoid.get_landmarks().size();
+        size_t count_offset = original.size() - landmark_count * (sizeof(std::int64_t) + shape.get_total() * sizeof(float)) -
+                              sizeof(std::int32_t);
+        std::vector<std::pair<size_t, std::int64_t>> corruptions = {
+            {count_offset, -1}, {count_offset, shape.get_total() + 1}, {count_offset + sizeof(std::int32_t), shape.get_total()}};
+        std::string corrupted_name = std::string(OUTPUT_DIR) + "landmarks_corrupted.alt";
+        for (const auto& corruption : corruptions) {
+            std::string corrupted = original;
+            if (corruption.first == count_offset) {
+                std::int32_t count = static_cast<std::int32_t>(corruption.second);
+                std::memcpy(&corrupted[corruption.first], &count, sizeof(count));
+            } else {
+                std::memcpy(&corrupted[corruption.first], &corruption.second, sizeof(corruption.second));
+            }
+            std::ofstream(corrupted_name, std::ios::binary) << corrupted;
+            bool corrupted_rejected = false;
+            try {
+                LandmarkHeuristic damaged;
+                damaged.load(corrupted_name, &maze);
+            } catch (const std::runtime_error&) {
+                corrupted_rejected = true;
+            }
+            check(corrupted_rejected, "Un fichier corrompu doit être refusé");
+        }
+        std::cout << "Tables rechargées, autre carte et fichiers corrompus refusés" << std::endl;
+
+        // Test 4: Adaptateur statique
+        std::cout << "\n--- Test 4: StaticAStar<LandmarkDistance> ---" << std::endl;
+        StaticAStar<LandmarkDistance> static_alt(&maze, 1.0f, LandmarkDistance{&loaded});
+        static_alt.add_start({0.0f, 0.0f});
+        static_alt.add_end(goal);
+        static_alt.execute();
+        check(static_alt.get_value(goal) == optimal, "StaticAStar<LandmarkDistance> non optimal");
+
+        std::cout << "Coût " << static_alt.get_value(goal) << ", " << static_alt.get_statistics().expansions
+                  << " expansions" << std::endl;
+
+        // Test 5: Arrivée flottante : h(n) <= valeur interpolée du champ de Dijkstra issu de n
+        std::cout << "\n--- Test 5: Arrivée flottante ---" << std::endl;
+        std::vector<float> floating_goal;
+        for (int x = 119; x >= 0 && floating_goal.empty(); x--) {
+            for (int y = 119; y >= 0 && floating_goal.empty(); y--) {
+                bool free_block = true;
+                for (int dx = 0; dx < 2; dx++) {
+                    for (int dy = 0; dy < 2; dy++) {
+                        std::vector<float> corner = {static_cast<float>(x + dx), static_cast<float>(y + dy)};
+                        free_block = free_block && !std::isinf(from_start.get_value(corner));
+                    }
+                }
+                if (free_block) floating_goal = {x + 0.25f, y + 0.75f};
+            }
+        }
+        check(!floating_goal.empty(), "Un bloc 2x2 libre est attendu");
+        int checked = 0;
+        for (long long index = 0; index < shape.get_total(); index += 211) {
+            if (std::isinf(from_start.get_workspace().get_value(index))) continue;
+            Dijkstra from_cell(&maze);
+            from_cell.set_verbose(false);
+            from_cell.add_start(maze.cell(index).get_coords());
+            from_cell.execute();
+            float exact = 0.0f;
+            for (const auto& corner : maze.get_hypercube_corners_with_weights(floating_goal)) {
+                exact += corner.second * from_cell.get_workspace().get_value(corner.first);
+            }
+            for (LandmarkHeuristic* alt : {&farthest, &avoid, &loaded}) {
+                check(alt->estimate(index, floating_goal) <= exact + 1e-4f,
+                      alt->get_name() + " surestime la distance à une arrivée flottante");
+            }
+            checked++;
+        }
+        std::cout << checked << " cellules : borne flottante <= valeur interpolée" << std::endl;
+
+        std::cout << "\n=== Tests Heuristique ALT terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test ALT: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
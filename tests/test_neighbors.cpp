@@ -0,0 +1,190 @@
+#include "Environnement.hpp"
+#include "PeriodicEnvironnement.hpp"
+#include "algorithms/graph/Dijkstra.hpp"
+#include "algorithms/graph/neighbors/GridNeighbors.hpp"
+#include "algorithms/graph/neighbors/EuclideanNeighbors.hpp"
+#include "TestUtils.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+
+#ifndef OUTPUT_DIR
+#define OUTPUT_DIR ""
+#endif
+
+static float octile(float dx, float dy)
+{
+    dx = std::abs(dx);
+    dy = std::abs(dy);
+    return std::sqrt(2.0f) * std::min(dx, dy) + std::abs(dx - dy);
+}
+
+int main() {
+    try {
+        std::cout << "=== Tests Voisinages ===" << std::endl;
+
+        // Test 1: Taille des stencils
+        std::cout << "\n--- Test 1: Taille des stencils ---" << std::endl;
+        Environnement env2d = Environnement::createRandomEnvironment({30, 20}, 0.0, 1, Environnement::DENSE);
+        Environnement env3d = Environnement::createRandomEnvironment({8, 8, 8}, 0.0, 1, Environnement::DENSE);
+
+        GridNeighbors axial(GridNeighbors::AXIAL);
+        GridNeighbors full(GridNeighbors::FULL);
+        GridNeighbors faces_edges(2);
+
+        axial.set_environment(&env2d);
+        full.set_environment(&env2d);
+        check(axial.get_max_neighbors() == 4, "AXIAL 2D doit avoir 4 voisins");
+        check(full.get_max_neighbors() == 8, "FULL 2D doit avoir 8 voisins");
+
+        full.set_environment(&env3d);
+        faces_edges.set_environment(&env3d);
+        check(full.get_max_neighbors() == 26, "FULL 3D doit avoir 26 voisins");
+        check(faces_edges.get_max_neighbors() == 18, "GridNeighbors(2) 3D doit avoir 18 voisins");
+        std::cout << axial.get_name() << ", " << full.get_name() << ", " << faces_edges.get_name() << " OK" << std::endl;
+
+        // Test 2: Dijkstra 8-connexe sur carte vide = distance octile
+        std::cout << "\n--- Test 2: Dijkstra 8-connexe ---" << std::endl;
+        Dijkstra dijkstra8(&env2d);
+        dijkstra8.set_neighborhood(&full);
+        dijkstra8.add_start({3.0f, 4.0f});
+        dijkstra8.execute();
+        for (int x = 0; x < 30; x++) {
+            for (int y = 0; y < 20; y++) {
+                float expected = octile(x - 3.0f, y - 4.0f);
+                float value = dijkstra8.get_value({static_cast<float>(x), static_cast<float>(y)});
+                check(std::abs(value - expected) < 1e-3f,
+                      "Distance octile incorrecte en (" + std::to_string(x) + ", " + std::to_string(y) + ")");
+            }
+        }
+        dijkstra8.save_U_values_image(std::string(OUTPUT_DIR) + "neighbors_dijkstra8.png");
+        std::cout << "Distances octiles exactes" << std::endl;
+
+        // Test 3: GridNeighbors AXIAL = voisins de l'environnement
+        std::cout << "\n--- Test 3: AXIAL vs voisins de l'environnement ---" << std::endl;
+        Environnement maze = Environnement::createMazeEnvironment({40, 30}, 12, Environnement::DENSE);
+        Dijkstra reference(&maze);
+        reference.add_start({0.0f, 0.0f});
+        reference.execute();
+
+        Dijkstra dijkstra4(&maze);
+        dijkstra4.set_neighborhood(&axial);
+        dijkstra4.add_start({0.0f, 0.0f});
+        dijkstra4.execute();
+        for (int x = 0; x < 40; x++) {
+            for (int y = 0; y < 30; y++) {
+                std::vector<float> coords = {static_cast<float>(x), static_cast<float>(y)};
+                check(reference.get_value(coords) == dijkstra4.get_value(coords), "AXIAL diffère de get_neigh");
+            }
+        }
+        std::cout << "Champs identiques" << std::endl;
+
+        // Test 4: Diagonales à travers un bord périodique
+        std::cout << "\n--- Test 4: 8-connexe périodique ---" << std::endl;
+        PeriodicEnvironnement torus({10, 10}, {true, true}, Environnement::DENSE);
+        Dijkstra dijkstra_torus(&torus);
+        dijkstra_torus.set_neighborhood(&full);
+        dijkstra_torus.add_start({0.0f, 0.0f});
+        dijkstra_torus.execute();
+        float wrapped = dijkstra_torus.get_value({9.0f, 9.0f});
+        check(std::abs(wrapped - std::sqrt(2.0f)) < 1e-5f, "Diagonale périodique attendue");
+        std::cout << "(0,0) -> (9,9) sur le tore: " << wrapped << std::endl;
+
+        // Test 5: Taille des stencils euclidiens
+        std::cout << "\n--- Test 5: Stencils euclidiens ---" << std::endl;
+        const float radii[] = {1.0f, std::sqrt(2.0f), std::sqrt(5.0f), std::sqrt(13.0f)};
+        const int expected_sizes[] = {4, 8, 16, 32};
+        for (int k = 0; k < 4; k++) {
+            EuclideanNeighbors euclidean(radii[k]);
+            euclidean.set_environment(&env2d);
+            check(euclidean.get_max_neighbors() == expected_sizes[k],
+                  euclidean.get_name() + " : " + std::to_string(euclidean.get_max_neighbors()) + " voisins");
+            std::cout << euclidean.get_name() << " : " << euclidean.get_max_neighbors() << " voisins" << std::endl;
+        }
+        EuclideanNeighbors cube(std::sqrt(3.0f));
+        cube.set_environment(&env3d);
+        check(cube.get_max_neighbors() == 26, "r = √3 en 3D doit avoir 26 voisins");
+
+        // Test 6: Dijkstra 16 / 32-connexe plus proche de la distance euclidienne que 8-connexe
+        std::cout << "\n--- Test 6: Qualité des distances ---" << std::endl;
+        EuclideanNeighbors n16(std::sqrt(5.0f));
+        EuclideanNeighbors n32(std::sqrt(13.0f));
+        Dijkstra dijkstra16(&env2d);
+        dijkstra16.set_neighborhood(&n16);
+        dijkstra16.add_start({3.0f, 4.0f});
+        dijkstra16.execute();
+        Dijkstra dijkstra32(&env2d);
+        dijkstra32.set_neighborhood(&n32);
+        dijkstra32.add_start({3.0f, 4.0f});
+        dijkstra32.execute();
+
+        check(std::abs(dijkstra16.get_value({13.0f, 9.0f}) - 5.0f * std::sqrt(5.0f)) < 1e-4f, "Distance (10, 5) attendue: 5√5");
+        float error8 = 0.0f, error16 = 0.0f, error32 = 0.0f;
+        for (int x = 0; x < 30; x++) {
+            for (int y = 0; y < 20; y++) {
+                std::vector<float> coords = {static_cast<float>(x), static_cast<float>(y)};
+                float exact = std::hypot(x - 3.0f, y - 4.0f);
+                float v8 = dijkstra8.get_value(coords), v16 = dijkstra16.get_value(coords), v32 = dijkstra32.get_value(coords);
+                check(v16 >= exact - 1e-4f && v32 >= exact - 1e-4f, "Distance inférieure à la distance euclidienne");
+                check(v16 <= v8 + 1e-4f && v32 <= v16 + 1e-4f, "Un stencil plus large ne doit pas allonger les chemins");
+                error8 = std::max(error8, (v8 - exact) / std::max(exact, 1.0f));
+                error16 = std::max(error16, (v16 - exact) / std::max(exact, 1.0f));
+                error32 = std::max(error32, (v32 - exact) / std::max(exact, 1.0f));
+            }
+        }
+        check(error16 < error8 && error32 < error16, "L'erreur doit décroître avec le rayon");
+        std::cout << "Erreur relative max: 8-connexe " << error8 << ", 16-connexe " << error16
+                  << ", 32-connexe " << error32 << std::endl;
+
+        // Test 7: Les grands déplacements ne traversent pas un mur fin
+        std::cout << "\n--- Test 7: Mur fin ---" << std::endl;
+        Environnement walled = Environnement::createRandomEnvironment({11, 11}, 0.0, 1, Environnement::DENSE);
+        for (int y = 0; y < 11; y++) {
+            walled.set_obs(walled.index_of({5.0f, static_cast<float>(y)}), true);
+        }
+        Dijkstra dijkstra_wall(&walled);
+        dijkstra_wall.set_neighborhood(&n32);
+        dijkstra_wall.add_start({2.0f, 5.0f});
+        dijkstra_wall.execute();
+        for (int y = 0; y < 11; y++) {
+            check(std::isinf(dijkstra_wall.get_value({7.0f, static_cast<float>(y)})), "Le mur a été traversé");
+        }
+        std::cout << "Aucune arête ne traverse le mur" << std::endl;
+
+        // Test 8: Voisinage partagé entre deux cartes de mêmes dimensions
+        std::cout << "\n--- Test 8: Voisinage partagé ---" << std::endl;
+        Environnement map_a = Environnement::createRandomEnvironment({80, 80}, 0.25, 3, Environnement::DENSE);
+        Environnement map_b = Environnement::createRandomEnvironment({80, 80}, 0.25, 4, Environnement::DENSE);
+        map_a.set_obs(map_a.index_of({40.0f, 40.0f}), false);
+        map_b.set_obs(map_b.index_of({40.0f, 40.0f}), false);
+        EuclideanNeighbors shared(std::sqrt(13.0f)), own(std::sqrt(13.0f));
+        Dijkstra search_a(&map_a), search_b(&map_b), reference_a(&map_a);
+        search_a.set_neighborhood(&shared);
+        search_b.set_neighborhood(&shared); // Dernière liaison : carte B
+        reference_a.set_neighborhood(&own);
+        for (Dijkstra* search : {&search_a, &search_b, &reference_a}) {
+            search->set_verbose(false);
+            search->add_start({40.0f, 40.0f});
+        }
+        search_a.execute();
+        reference_a.execute();
+        search_b.execute();
+        search_a.execute(); // Après une recherche sur B avec le même voisinage
+        for (long long index = 0; index < map_a.get_shape().get_total(); index++) {
+            float a = search_a.get_workspace().get_value(index), expected = reference_a.get_workspace().get_value(index);
+            check(a == expected || (std::isinf(a) && std::isinf(expected)),
+                  "Le voisinage partagé doit utiliser les obstacles de la carte de la recherche");
+        }
+        std::cout << "Champs identiques avec un voisinage partagé et un voisinage propre" << std::endl;
+
+        std::cout << "\n=== Tests Voisinages terminés avec succès! ===" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur dans test Voisinages: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}